@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:12 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:12 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+# include "../inc/philo.h"
+# include <sys/wait.h>
+# include <signal.h>
+# include <poll.h>
+# include <fcntl.h>
+/*  DRIVER  */
+# define BENCH_TIMEOUT_MS 30000
+# define BENCH_READ_SIZE 4096
+# define BENCH_LINE_SIZE 128
+# define BENCH_MAX_ARGS 16
+# define BENCH_VALUE_SIZE 24
+# define BENCH_POSITIONALS 5
+# define BENCH_EXEC_FAILED 127
+/*  SWEEP  */
+# define BENCH_N_SIZES 7
+# define BENCH_N_TIMINGS 3
+# define BENCH_N_MEALS 2
+# define BENCH_N_CASES (BENCH_N_SIZES * BENCH_N_TIMINGS * BENCH_N_MEALS)
+/*  OUTPUT MATCHING  */
+# define BENCH_EAT_SUFFIX " is eating"
+# define BENCH_DIED_SUFFIX " died"
+/*  CSV  */
+# define BENCH_CSV_HEADER "options,n_philo,t_die,t_eat,t_sleep,meals,\
+wall_ms,meals_eaten,meals_per_s,user_ms,sys_ms,nvcsw,nivcsw,max_rss_kb,\
+died,timed_out,exit_status\n"
+# define BENCH_CSV_CASE "%s,%d,%ld,%ld,%ld,%d,"
+# define BENCH_CSV_RESULT "%ld,%ld,%.0f,%ld,%ld,%ld,%ld,%ld,%d,%d,%d\n"
+# define ERR_BENCH_USAGE "usage: bench_driver ./philo [philo options...]\n"
+/*  LOCKS  */
+# define BENCH_LOCK_ROUNDS 10000000L
+# define BENCH_LOCK_RUN_US 500000L
+# define BENCH_LOCK_THREADS 2
+# define BENCH_LOCK_ROW "%-8s %3zu bytes %6.1f ns uncontended %9.0f ops/s \
+contended, handoff avg %6ld us, shares %4.1f%% / %4.1f%%\n"
+/*  FORMAT  */
+# define BENCH_FORMAT_LINES 20000000L
+# define BENCH_FORMAT_BATCH 256
+# define BENCH_FORMAT_IDS 200
+# define BENCH_FORMAT_STEP_US 37
+# define BENCH_FORMAT_ROW "%-8s %12.0f lines/s %8.1f ns/line\n"
+# define BENCH_FORMAT_SINK "/dev/null"
+/*  TYPEDEF STRUCT  */
+typedef struct s_bench_case
+{
+	int				n_philo;
+	long			t_die;
+	long			t_eat;
+	long			t_sleep;
+	int				meals;
+}				t_bench_case;
+typedef struct s_bench_result
+{
+	long			wall_us;
+	long			meals;
+	int				died;
+	int				timed_out;
+	int				status;
+	struct rusage	usage;
+	char			line[BENCH_LINE_SIZE];
+	int				line_len;
+}				t_bench_result;
+typedef struct s_bench_lock
+{
+	t_data			data;
+	t_fork			fork;
+	long			deadline;
+	long			released_at;
+	int				last_holder;
+	long			handoffs;
+	long			handoff_total;
+}				t_bench_lock;
+typedef struct s_lock_worker
+{
+	t_bench_lock	*bench;
+	pthread_t		thread;
+	int				id;
+	long			count;
+}				t_lock_worker;
+/*  PROTOTYPE  */
+long	bench_now_us(void);
+int		run_bench_case(char **argv, t_bench_result *result);
+void	fill_args(t_bench_case *bc, char (*values)[BENCH_VALUE_SIZE],
+			char **argv, char **options);
+void	join_options(char **options, char *out);
+void	print_row(t_bench_case *bc, t_bench_result *r, const char *options);
+#endif
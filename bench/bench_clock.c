@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_clock.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:19 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:19 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+#define BENCH_ITERATIONS 10000000L
+
+/**
+ * @function        read_gettimeofday_ms
+ * @brief           Lecture d'horloge historique, via gettimeofday en ms.
+ * @param long      t0 - Le temps d'origine en millisecondes.
+ * 
+ * @description     Reproduit l'ancien get_time pour servir de référence.
+ * 
+ * @return          Le temps écoulé depuis t0 en millisecondes.
+ */
+long	read_gettimeofday_ms(long t0)
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_usec / US_TO_MS + tv.tv_sec * SEC_TO_MS - t0);
+}
+
+/**
+ * @function        read_monotonic_us
+ * @brief           Lecture d'horloge actuelle, via CLOCK_MONOTONIC en µs.
+ * @param long      t0 - Le temps d'origine en microsecondes.
+ * 
+ * @description     Même calcul que get_time dans philo_utils.c.
+ * 
+ * @return          Le temps écoulé depuis t0 en microsecondes.
+ */
+long	read_monotonic_us(long t0)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * SEC_TO_US + ts.tv_nsec / US_TO_NS - t0);
+}
+
+/**
+ * @function        elapsed_ns
+ * @brief           Mesure le temps total de BENCH_ITERATIONS lectures.
+ * @param long      (*read)(long) - La fonction de lecture à mesurer.
+ * 
+ * @description     Accumule les valeurs lues pour empêcher le compilateur
+ *                  d'éliminer les appels.
+ * 
+ * @return          La durée totale en nanosecondes.
+ */
+long	elapsed_ns(long (*read)(long))
+{
+	struct timespec	start;
+	struct timespec	end;
+	long			i;
+	volatile long	sink;
+
+	i = 0;
+	sink = 0;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	while (i++ < BENCH_ITERATIONS)
+		sink += read(0);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	(void)sink;
+	return ((end.tv_sec - start.tv_sec) * SEC_TO_NS
+		+ end.tv_nsec - start.tv_nsec);
+}
+
+/**
+ * @function        main
+ * @brief           Compare le coût d'une lecture d'horloge.
+ * 
+ * @description     Affiche le coût moyen par appel de l'ancienne et de la
+ *                  nouvelle horloge, en nanosecondes.
+ * 
+ * @return          SUCCESS.
+ * 
+ * @example         make bench_clock && ./bench/bench_clock
+ */
+int	main(void)
+{
+	printf("gettimeofday (ms)      %6.1f ns/call\n",
+		(double)elapsed_ns(&read_gettimeofday_ms) / BENCH_ITERATIONS);
+	printf("CLOCK_MONOTONIC (us)   %6.1f ns/call\n",
+		(double)elapsed_ns(&read_monotonic_us) / BENCH_ITERATIONS);
+	return (SUCCESS);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_csv.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:12 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:12 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @function        join_options
+ * @brief           Joint les options de philo pour la colonne du CSV.
+ * @param char      **options - Les options, terminées par NULL.
+ * @param char      *out - Reçoit les options séparées par des espaces,
+ *                  BENCH_LINE_SIZE octets au plus.
+ * 
+ * @description     Sans option, la colonne vaut "threads", le mode par
+ *                  défaut.
+ * 
+ * @return          Aucun.
+ */
+void	join_options(char **options, char *out)
+{
+	int	i;
+
+	snprintf(out, BENCH_LINE_SIZE, "%s", STATS_MODE_THREADS);
+	if (!options[0])
+		return ;
+	out[0] = '\0';
+	i = 0;
+	while (options[i])
+	{
+		if (i)
+			strncat(out, " ", BENCH_LINE_SIZE - strlen(out) - 1);
+		strncat(out, options[i], BENCH_LINE_SIZE - strlen(out) - 1);
+		i++;
+	}
+}
+
+/**
+ * @function        print_row
+ * @brief           Écrit la ligne CSV d'une configuration.
+ * @param t_bench_case *bc - La configuration.
+ * @param t_bench_result *r - Ses mesures.
+ * @param const     char *options - Les options passées à philo.
+ * 
+ * @return          Aucun.
+ */
+void	print_row(t_bench_case *bc, t_bench_result *r, const char *options)
+{
+	long	wall;
+
+	wall = r->wall_us;
+	if (wall < 1)
+		wall = 1;
+	printf(BENCH_CSV_CASE, options, bc->n_philo, bc->t_die, bc->t_eat,
+		bc->t_sleep, bc->meals);
+	printf(BENCH_CSV_RESULT, r->wall_us / US_TO_MS, r->meals,
+		(double)r->meals * SEC_TO_US / wall,
+		r->usage.ru_utime.tv_sec * SEC_TO_MS
+		+ r->usage.ru_utime.tv_usec / US_TO_MS,
+		r->usage.ru_stime.tv_sec * SEC_TO_MS
+		+ r->usage.ru_stime.tv_usec / US_TO_MS,
+		r->usage.ru_nvcsw, r->usage.ru_nivcsw, r->usage.ru_maxrss,
+		r->died, r->timed_out, r->status);
+	fflush(stdout);
+}
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_driver.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:12 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:12 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @function        bench_now_us
+ * @brief           Horloge monotone en microsecondes.
+ * 
+ * @description     Même base que get_time, sans dépendre des sources de
+ *                  philo.
+ * 
+ * @return          Le temps monotone courant en microsecondes.
+ */
+long	bench_now_us(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * SEC_TO_US + ts.tv_nsec / US_TO_NS);
+}
+
+/**
+ * @function        fill_args
+ * @brief           Construit la ligne de commande d'une configuration.
+ * @param t_bench_case *bc - La configuration.
+ * @param char      (*values)[BENCH_VALUE_SIZE] - Stockage des nombres.
+ * @param char      **argv - Reçoit philo, ses 5 arguments puis les
+ *                  options passées au driver.
+ * @param char      **options - Les options, terminées par NULL ; main en
+ *                  borne le nombre à la taille de argv.
+ * 
+ * @return          Aucun.
+ */
+void	fill_args(t_bench_case *bc, char (*values)[BENCH_VALUE_SIZE],
+	char **argv, char **options)
+{
+	int	i;
+
+	snprintf(values[0], BENCH_VALUE_SIZE, "%d", bc->n_philo);
+	snprintf(values[1], BENCH_VALUE_SIZE, "%ld", bc->t_die);
+	snprintf(values[2], BENCH_VALUE_SIZE, "%ld", bc->t_eat);
+	snprintf(values[3], BENCH_VALUE_SIZE, "%ld", bc->t_sleep);
+	snprintf(values[4], BENCH_VALUE_SIZE, "%d", bc->meals);
+	i = 0;
+	while (i < BENCH_POSITIONALS)
+	{
+		argv[i + 1] = values[i];
+		i++;
+	}
+	while (options[i - BENCH_POSITIONALS])
+	{
+		argv[i + 1] = options[i - BENCH_POSITIONALS];
+		i++;
+	}
+	argv[i + 1] = NULL;
+}
+
+/**
+ * @function        bench_case
+ * @brief           Décode le numéro d'une configuration du balayage.
+ * @param int       i - Numéro, de 0 à BENCH_N_CASES - 1.
+ * @param t_bench_case *bc - Reçoit la configuration.
+ * 
+ * @description     Tailles de 1 à 4000 philosophes, trois jeux de durées
+ *                  (large, juste, mortel) et deux limites de repas. Les
+ *                  limites font varier le plus vite.
+ * 
+ * @return          Aucun.
+ */
+void	bench_case(int i, t_bench_case *bc)
+{
+	static const int	sizes[BENCH_N_SIZES] = {1, 2, 5, 31, 200, 1000,
+		4000};
+	static const long	timings[BENCH_N_TIMINGS][3] = {{800, 200, 200},
+	{410, 200, 200}, {310, 200, 100}};
+	static const int	meals[BENCH_N_MEALS] = {3, 10};
+
+	bc->meals = meals[i % BENCH_N_MEALS];
+	i /= BENCH_N_MEALS;
+	bc->t_die = timings[i % BENCH_N_TIMINGS][0];
+	bc->t_eat = timings[i % BENCH_N_TIMINGS][1];
+	bc->t_sleep = timings[i % BENCH_N_TIMINGS][2];
+	bc->n_philo = sizes[i / BENCH_N_TIMINGS];
+}
+
+/**
+ * @function        run_sweep
+ * @brief           Exécute toutes les configurations du balayage.
+ * @param char      **argv - argv[0] est philo, suivi des options.
+ * @param const     char *options - Les options, jointes pour le CSV.
+ * 
+ * @return          SUCCESS ou FAILURE si philo n'a pas pu être lancé.
+ */
+int	run_sweep(char **argv, const char *options)
+{
+	char				values[BENCH_POSITIONALS][BENCH_VALUE_SIZE];
+	char				*args[BENCH_MAX_ARGS];
+	t_bench_result		result;
+	t_bench_case		bc;
+	int					i;
+
+	args[0] = argv[0];
+	i = 0;
+	while (i < BENCH_N_CASES)
+	{
+		bench_case(i, &bc);
+		fill_args(&bc, values, args, argv + 1);
+		if (run_bench_case(args, &result))
+			return (FAILURE);
+		print_row(&bc, &result, options);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        main
+ * @brief           Point d'entrée du banc d'essai de bout en bout.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - philo suivi de ses options (--tasks, ...).
+ * 
+ * @description     Vérifie que philo est exécutable, puis écrit une ligne
+ *                  CSV par configuration sur stdout, pour comparer deux
+ *                  versions ou deux modes.
+ * 
+ * @return          SUCCESS, ou FAILURE sur erreur d'usage ou de lancement.
+ */
+int	main(int argc, char **argv)
+{
+	char	options[BENCH_LINE_SIZE];
+
+	if (argc < 2 || argc > BENCH_MAX_ARGS - BENCH_POSITIONALS - 1)
+	{
+		fprintf(stderr, ERR_BENCH_USAGE);
+		return (FAILURE);
+	}
+	if (access(argv[1], X_OK))
+	{
+		perror(argv[1]);
+		return (FAILURE);
+	}
+	join_options(argv + 2, options);
+	printf(BENCH_CSV_HEADER);
+	if (run_sweep(argv + 1, options))
+	{
+		perror(argv[1]);
+		return (FAILURE);
+	}
+	return (SUCCESS);
+}
@@ -0,0 +1,188 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_format.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:12:44 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 01:12:44 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @function        printf_record
+ * @brief           Ancien chemin : un printf par ligne.
+ * @param t_log_record *record - L'enregistrement à imprimer.
+ * 
+ * @description     L'ancien print_log_record, gardé comme référence :
+ *                  chaque ligne analyse sa chaîne de format LOG_*.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture dans le tampon de stdout.
+ * 
+ * @example         printf_record(&record);
+ * 
+ * @dependencies    printf
+ * 
+ * @control_flow    1. Sélection du format.
+ *                  2. Impression.
+ */
+void	printf_record(t_log_record *record)
+{
+	long	time;
+
+	time = record->time / US_TO_MS;
+	if (record->event == LOG_EV_FORK)
+		printf(LOG_FORK, time, record->id);
+	else if (record->event == LOG_EV_EAT)
+		printf(LOG_EAT, time, record->id);
+	else if (record->event == LOG_EV_SLEEPING)
+		printf(LOG_SLEEPING, time, record->id);
+	else if (record->event == LOG_EV_THINKING)
+		printf(LOG_THINKING, time, record->id);
+	else if (record->event == LOG_EV_DIED)
+		printf(LOG_DIED, time, record->id);
+}
+
+/**
+ * @function        next_record
+ * @brief           Enregistrement numéro i d'une table imaginaire.
+ * @param t_log_record *record - Reçoit l'enregistrement.
+ * @param long      i - Son numéro.
+ * 
+ * @description     Horodatages croissants, identifiants et évènements
+ *                  variés : les deux chemins formatent les mêmes lignes.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         next_record(&record, i);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Remplissage.
+ */
+void	next_record(t_log_record *record, long i)
+{
+	record->time = i * BENCH_FORMAT_STEP_US;
+	record->id = i % BENCH_FORMAT_IDS + PHILO_ID_OFFSET;
+	record->event = i % (LOG_EV_DIED + 1);
+}
+
+/**
+ * @function        printf_lines_per_s
+ * @brief           Débit de l'ancien chemin, printf puis fflush par lot.
+ * @param           Aucun.
+ * 
+ * @description     Comme l'ancien drain_log : BENCH_FORMAT_BATCH lignes
+ *                  par printf, puis un fflush.
+ * 
+ * @return          Lignes par seconde.
+ * 
+ * @side_effect     Écriture sur stdout.
+ * 
+ * @example         rate = printf_lines_per_s();
+ * 
+ * @dependencies    printf_record, next_record, fflush, get_time
+ * 
+ * @control_flow    1. BENCH_FORMAT_LINES lignes chronométrées.
+ */
+double	printf_lines_per_s(void)
+{
+	t_log_record	record;
+	long			start;
+	long			i;
+
+	i = 0;
+	start = get_time(0);
+	while (i < BENCH_FORMAT_LINES)
+	{
+		next_record(&record, i++);
+		printf_record(&record);
+		if (i % BENCH_FORMAT_BATCH == 0)
+			fflush(stdout);
+	}
+	fflush(stdout);
+	return ((double)BENCH_FORMAT_LINES * SEC_TO_US / (get_time(0) - start));
+}
+
+/**
+ * @function        format_lines_per_s
+ * @brief           Débit du chemin actuel, format_log_record et write.
+ * @param t_log     *log - Journal dont seul le tampon de sortie sert.
+ * 
+ * @description     Comme drain_log : BENCH_FORMAT_BATCH lignes dans le
+ *                  tampon du journal, puis un seul write.
+ * 
+ * @return          Lignes par seconde.
+ * 
+ * @side_effect     Écriture sur stdout.
+ * 
+ * @example         rate = format_lines_per_s(&log);
+ * 
+ * @dependencies    print_log_record, next_record, flush_log_output,
+ *                  get_time
+ * 
+ * @control_flow    1. BENCH_FORMAT_LINES lignes chronométrées.
+ */
+double	format_lines_per_s(t_log *log)
+{
+	t_log_record	record;
+	long			start;
+	long			i;
+
+	i = 0;
+	start = get_time(0);
+	while (i < BENCH_FORMAT_LINES)
+	{
+		next_record(&record, i++);
+		print_log_record(log, &record);
+		if (i % BENCH_FORMAT_BATCH == 0)
+			flush_log_output(log);
+	}
+	flush_log_output(log);
+	return ((double)BENCH_FORMAT_LINES * SEC_TO_US / (get_time(0) - start));
+}
+
+/**
+ * @function        main
+ * @brief           Compare printf et le formateur du journal.
+ * 
+ * @description     Les deux chemins écrivent dans /dev/null : seul le
+ *                  formatage et les appels système sont mesurés. stdout
+ *                  est rétabli pour afficher les résultats.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @example         make bench_format && ./bench/bench_format
+ */
+int	main(void)
+{
+	t_log	log;
+	double	old_rate;
+	double	new_rate;
+	int		saved;
+	int		sink;
+
+	log.out = malloc(LOG_OUT_SIZE);
+	log.out_len = 0;
+	saved = dup(STDOUT_FILENO);
+	sink = open(BENCH_FORMAT_SINK, O_WRONLY);
+	if (!log.out || saved < 0 || sink < 0
+		|| dup2(sink, STDOUT_FILENO) < 0)
+		return (FAILURE);
+	old_rate = printf_lines_per_s();
+	new_rate = format_lines_per_s(&log);
+	dup2(saved, STDOUT_FILENO);
+	close(sink);
+	close(saved);
+	free(log.out);
+	printf(BENCH_FORMAT_ROW, "printf", old_rate, SEC_TO_NS / old_rate);
+	printf(BENCH_FORMAT_ROW, "format", new_rate, SEC_TO_NS / new_rate);
+	return (SUCCESS);
+}
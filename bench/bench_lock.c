@@ -0,0 +1,203 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_lock.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:40:02 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 19:40:02 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @function        uncontended_ns
+ * @brief           Coût d'un verrouillage suivi d'un déverrouillage libre.
+ * @param t_bench_lock *bench - Le verrou mesuré.
+ * 
+ * @description     Un seul thread : c'est le chemin rapide, celui de la
+ *                  plupart des prises de fourchette.
+ * 
+ * @return          Nanosecondes par paire lock/unlock.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         ns = uncontended_ns(&bench);
+ * 
+ * @dependencies    fork_lock, fork_unlock, get_time
+ * 
+ * @control_flow    1. BENCH_LOCK_ROUNDS paires chronométrées.
+ */
+double	uncontended_ns(t_bench_lock *bench)
+{
+	long	start;
+	long	i;
+
+	i = 0;
+	start = get_time(0);
+	while (i++ < BENCH_LOCK_ROUNDS)
+	{
+		fork_lock(&bench->data, &bench->fork, NULL);
+		fork_unlock(&bench->data, &bench->fork);
+	}
+	return ((double)(get_time(0) - start) * US_TO_NS / BENCH_LOCK_ROUNDS);
+}
+
+/**
+ * @function        lock_worker
+ * @brief           Un voisin qui prend et rend la fourchette en boucle.
+ * @param void      *arg - Son t_lock_worker.
+ * 
+ * @description     Sous le verrou, note le délai depuis la dernière
+ *                  libération quand la fourchette change de main : c'est
+ *                  la latence de remise entre voisins.
+ * 
+ * @return          NULL.
+ * 
+ * @side_effect     Mise à jour des compteurs du banc.
+ * 
+ * @example         pthread_create(&w.thread, NULL, &lock_worker, &w);
+ * 
+ * @dependencies    fork_lock, fork_unlock, get_time
+ * 
+ * @control_flow    1. Jusqu'à l'échéance : prendre, mesurer, rendre.
+ */
+void	*lock_worker(void *arg)
+{
+	t_lock_worker	*worker;
+	t_bench_lock	*bench;
+	long			now;
+
+	worker = arg;
+	bench = worker->bench;
+	while (get_time(0) < bench->deadline)
+	{
+		fork_lock(&bench->data, &bench->fork, NULL);
+		now = get_time(0);
+		if (bench->last_holder != worker->id && bench->released_at)
+		{
+			bench->handoffs++;
+			bench->handoff_total += now - bench->released_at;
+		}
+		bench->last_holder = worker->id;
+		worker->count++;
+		bench->released_at = get_time(0);
+		fork_unlock(&bench->data, &bench->fork);
+	}
+	return (NULL);
+}
+
+/**
+ * @function        run_contended
+ * @brief           Fait se disputer la fourchette par deux voisins.
+ * @param t_bench_lock *bench - Le verrou mesuré.
+ * @param t_lock_worker *workers - BENCH_LOCK_THREADS voisins.
+ * 
+ * @description     Les voisins tournent BENCH_LOCK_RUN_US µs.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Création et attente de threads.
+ * 
+ * @example         run_contended(&bench, workers);
+ * 
+ * @dependencies    pthread_create, pthread_join, lock_worker
+ * 
+ * @control_flow    1. Remise à zéro des compteurs.
+ *                  2. Lancement puis attente des voisins.
+ */
+void	run_contended(t_bench_lock *bench, t_lock_worker *workers)
+{
+	int	i;
+
+	bench->deadline = get_time(0) + BENCH_LOCK_RUN_US;
+	bench->released_at = 0;
+	bench->last_holder = -1;
+	bench->handoffs = 0;
+	bench->handoff_total = 0;
+	i = -1;
+	while (++i < BENCH_LOCK_THREADS)
+	{
+		workers[i].bench = bench;
+		workers[i].id = i;
+		workers[i].count = 0;
+		pthread_create(&workers[i].thread, NULL, &lock_worker, &workers[i]);
+	}
+	i = -1;
+	while (++i < BENCH_LOCK_THREADS)
+		pthread_join(workers[i].thread, NULL);
+}
+
+/**
+ * @function        print_lock_row
+ * @brief           Affiche la ligne d'un verrou.
+ * @param t_bench_lock *bench - Le verrou mesuré.
+ * @param t_lock_worker *workers - Les voisins après la course.
+ * @param double    ns - Coût sans contention.
+ * 
+ * @description     Taille, coût libre, débit disputé, latence de remise et
+ *                  part de chaque voisin : 50 % / 50 % est parfaitement
+ *                  équitable.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stdout.
+ * 
+ * @example         print_lock_row(&bench, workers, ns);
+ * 
+ * @dependencies    printf
+ * 
+ * @control_flow    1. Calcul des parts et de la moyenne.
+ *                  2. Affichage.
+ */
+void	print_lock_row(t_bench_lock *bench, t_lock_worker *workers, double ns)
+{
+	long	total;
+
+	total = workers[0].count + workers[1].count;
+	if (total < 1)
+		total = 1;
+	if (bench->handoffs < 1)
+		bench->handoffs = 1;
+	printf(BENCH_LOCK_ROW, bench->data.locks->name, bench->data.locks->size,
+		ns, (double)total * SEC_TO_US / BENCH_LOCK_RUN_US,
+		bench->handoff_total / bench->handoffs,
+		100.0 * workers[0].count / total, 100.0 * workers[1].count / total);
+}
+
+/**
+ * @function        main
+ * @brief           Compare les verrous de fourchette.
+ * 
+ * @description     Pour chaque implémentation de --lock : coût sans
+ *                  contention, puis deux voisins qui se disputent une
+ *                  même fourchette.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @example         make bench_lock && ./bench/bench_lock
+ */
+int	main(void)
+{
+	static t_bench_lock	bench;
+	t_lock_worker		workers[BENCH_LOCK_THREADS];
+	double				ns;
+	int					id;
+
+	id = -1;
+	while (++id < LOCK_COUNT)
+	{
+		bench.data.locks = get_fork_lock(id);
+		if (bench.data.locks->init(&bench.fork.lock, 0))
+			return (FAILURE);
+		ns = uncontended_ns(&bench);
+		run_contended(&bench, workers);
+		print_lock_row(&bench, workers, ns);
+		if (bench.data.locks->destroy
+			&& bench.data.locks->destroy(&bench.fork.lock))
+			return (FAILURE);
+	}
+	return (SUCCESS);
+}
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:12 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:12 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @function        scan_line
+ * @brief           Compte un repas ou une mort dans une ligne du journal.
+ * @param t_bench_result *result - Le résultat en cours.
+ * 
+ * @description     La ligne complète est dans result->line, sans '\n'.
+ * 
+ * @return          Aucun.
+ */
+void	scan_line(t_bench_result *result)
+{
+	int	len;
+	int	eat;
+	int	died;
+
+	len = result->line_len;
+	eat = strlen(BENCH_EAT_SUFFIX);
+	died = strlen(BENCH_DIED_SUFFIX);
+	if (len >= eat && !strncmp(result->line + len - eat,
+			BENCH_EAT_SUFFIX, eat))
+		result->meals++;
+	else if (len >= died && !strncmp(result->line + len - died,
+			BENCH_DIED_SUFFIX, died))
+		result->died = 1;
+}
+
+/**
+ * @function        scan_output
+ * @brief           Découpe la sortie de philo en lignes.
+ * @param t_bench_result *result - Le résultat en cours.
+ * @param char      *buf - Les octets lus.
+ * @param ssize_t   len - Leur nombre.
+ * 
+ * @description     Une ligne peut être coupée entre deux lectures : le
+ *                  début est gardé dans result->line. Les lignes trop
+ *                  longues sont tronquées, elles ne sont pas du journal.
+ * 
+ * @return          Aucun.
+ */
+void	scan_output(t_bench_result *result, char *buf, ssize_t len)
+{
+	ssize_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (buf[i] == '\n')
+		{
+			scan_line(result);
+			result->line_len = 0;
+		}
+		else if (result->line_len < BENCH_LINE_SIZE)
+			result->line[result->line_len++] = buf[i];
+		i++;
+	}
+}
+
+/**
+ * @function        collect_output
+ * @brief           Lit la sortie de philo jusqu'à sa fin ou au délai.
+ * @param int       fd - Le côté lecture du tube.
+ * @param pid_t     pid - Le processus philo.
+ * @param t_bench_result *result - Le résultat en cours.
+ * @param long      start - Début du run, bench_now_us().
+ * 
+ * @description     Au-delà de BENCH_TIMEOUT_MS (une table qui survit sans
+ *                  limite de repas), philo est tué et le run marqué.
+ * 
+ * @return          Aucun.
+ */
+void	collect_output(int fd, pid_t pid, t_bench_result *result, long start)
+{
+	struct pollfd	pfd;
+	char			buf[BENCH_READ_SIZE];
+	ssize_t			len;
+	long			left;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	len = 1;
+	while (len > 0)
+	{
+		left = BENCH_TIMEOUT_MS - ((bench_now_us() - start) / US_TO_MS);
+		if (left <= 0 || poll(&pfd, 1, left) == 0)
+		{
+			kill(pid, SIGKILL);
+			result->timed_out = 1;
+			return ;
+		}
+		len = read(fd, buf, sizeof(buf));
+		if (len > 0)
+			scan_output(result, buf, len);
+	}
+}
+
+/**
+ * @function        start_philo
+ * @brief           Lance philo avec sa sortie standard dans un tube.
+ * @param char      **argv - Ligne de commande de philo.
+ * @param int       *fd - Reçoit le côté lecture du tube.
+ * 
+ * @description     stderr est envoyé vers /dev/null pour ne garder que le
+ *                  journal.
+ * 
+ * @return          Le pid de philo, ou -1 en cas d'échec.
+ */
+pid_t	start_philo(char **argv, int *fd)
+{
+	int		pipefd[2];
+	pid_t	pid;
+	int		null_fd;
+
+	if (pipe(pipefd))
+		return (-1);
+	pid = fork();
+	if (pid == 0)
+	{
+		null_fd = open("/dev/null", O_WRONLY);
+		dup2(pipefd[1], STDOUT_FILENO);
+		dup2(null_fd, STDERR_FILENO);
+		close(pipefd[0]);
+		close(pipefd[1]);
+		close(null_fd);
+		execv(argv[0], argv);
+		_exit(BENCH_EXEC_FAILED);
+	}
+	close(pipefd[1]);
+	*fd = pipefd[0];
+	if (pid < 0)
+		close(pipefd[0]);
+	return (pid);
+}
+
+/**
+ * @function        run_bench_case
+ * @brief           Exécute une configuration et mesure le processus.
+ * @param char      **argv - Ligne de commande de philo.
+ * @param t_bench_result *result - Reçoit les mesures.
+ * 
+ * @description     Temps réel mesuré autour du processus ; CPU,
+ *                  changements de contexte et RSS maximal viennent de
+ *                  wait4.
+ * 
+ * @return          SUCCESS ou FAILURE si philo n'a pas pu être lancé.
+ */
+int	run_bench_case(char **argv, t_bench_result *result)
+{
+	pid_t	pid;
+	int		fd;
+	long	start;
+
+	memset(result, 0, sizeof(*result));
+	start = bench_now_us();
+	pid = start_philo(argv, &fd);
+	if (pid < 0)
+		return (FAILURE);
+	collect_output(fd, pid, result, start);
+	close(fd);
+	if (wait4(pid, &result->status, 0, &result->usage) < 0)
+		return (FAILURE);
+	result->wall_us = bench_now_us() - start;
+	if (result->line_len)
+		scan_line(result);
+	if (WIFEXITED(result->status))
+		result->status = WEXITSTATUS(result->status);
+	else
+		result->status = -WTERMSIG(result->status);
+	return (SUCCESS);
+}
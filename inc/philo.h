@@ -14,6 +14,9 @@
 # define PHILO_H
 
 /*  Lib.  */
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
 # include <stdio.h>
 # include <pthread.h>
 # include <stdlib.h>
@@ -22,6 +25,18 @@
 # include <sys/time.h>
 # include <errno.h>
 # include <limits.h>
+# include <stdatomic.h>
+# include <stdint.h>
+# include <sys/syscall.h>
+# include <linux/futex.h>
+# include <string.h>
+# include <sys/resource.h>
+# include <sched.h>
+# include <fcntl.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/prctl.h>
+# include <sys/wait.h>
 
 /*  RETURN CODES  */
 # define SUCCESS 0
@@ -36,12 +51,17 @@
 /*  DEAD  */
 # define NO_ONE_DIED 0
 # define SOMEONE_DIED 1
+# define ALL_FED 2
 
 /*  CONTROL AND WHITESPACE CHARACTERES  */
 # define TAB_CHAR '\t'
 # define CARRIAGE_RETURN '\r'
 # define SPACE_CHAR ' '
 
+/*  ARGUMENTS  */
+# define ARG_T_DIE 2
+# define ARG_T_SLEEP 4
+
 /*  PHILOSOPHER ID MANIPULATIONS  */
 # define PHILO_ID_OFFSET 1
 
@@ -60,6 +80,22 @@
 /*  TIME  */
 # define US_TO_MS 1000
 # define SEC_TO_MS 1000
+# define US_TO_NS 1000
+# define SEC_TO_US 1000000L
+# define MAX_FRACTION_DIGITS 3
+# define SEC_TO_NS 1000000000L
+
+/*  SLEEP  */
+# define SLEEP_CALIBRATION_ROUNDS 8
+# define SLEEP_CALIBRATION_US 200
+# define SLEEP_TAIL_MIN_US 20
+# define SLEEP_TAIL_MAX_US 500
+
+/*  LAYOUT  */
+# define CACHE_LINE 64
+
+/*  MONITOR  */
+# define DEADLINE_GRACE_US 1
 
 /*  MEALS  */
 # define UNLIMITED_MEALS -1
@@ -78,7 +114,211 @@
 # define LOG_DIED "%ld %d died\n"
 # define LOG_FORK "%ld %d has taken a fork\n"
 # define LOG_EAT "%ld %d is eating\n"
+# define LOG_TEXT_SLEEPING " is sleeping\n"
+# define LOG_TEXT_THINKING " is thinking\n"
+# define LOG_TEXT_DIED " died\n"
+# define LOG_TEXT_FORK " has taken a fork\n"
+# define LOG_TEXT_EAT " is eating\n"
 
+/*  LOG EVENTS  */
+# define LOG_EV_FORK 0
+# define LOG_EV_EAT 1
+# define LOG_EV_SLEEPING 2
+# define LOG_EV_THINKING 3
+# define LOG_EV_DIED 4
+
+/*  LOG RING  */
+# define LOG_RING_SIZE 16384
+# define LOG_FLUSH_INTERVAL_US 1000
+# define LOG_BACKOFF_US 50
+# define LOG_RUNNING 1
+# define LOG_STOPPED 0
+# define LOG_OUT_SIZE 65536
+# define LOG_LINE_MAX 64
+# define LOG_LONG_DIGITS 21
+# define LOG_STATS "log: %lu records, %lu backpressured, %lu dropped\n"
+/*  TRACE  */
+# define TRACE_MAGIC "PHTRACE1"
+# define TRACE_MAGIC_LEN 8
+# define TRACE_MODE 0644
+# define TRACE_CLOSED -1
+# define TRACE_WINDOW 1048576
+# define TRACE_ALIGN 65536
+# define TRACE_RECORD_MAX 20
+# define TRACE_EVENT_BITS 3
+# define TRACE_EVENT_MASK 7
+# define TRACE_VARINT_BITS 7
+# define TRACE_VARINT_MASK 127
+# define TRACE_VARINT_MORE 128
+
+/*  OPTIONS  */
+# define OPT_PREFIX "--"
+# define OPT_TASKS "--tasks"
+# define OPT_WORKERS "--workers="
+# define OPT_STATS "--stats"
+# define OPT_SIMULATE "--simulate"
+# define OPT_SEED "--seed="
+# define OPT_UNTIL "--until="
+# define OPT_STRATEGY "--strategy="
+# define OPT_LOCK "--lock="
+# define OPT_SCHEDULE "--schedule="
+# define OPT_PROCESSES "--processes="
+# define OPT_AFFINITY "--affinity"
+# define OPT_STACK_SIZE "--stack-size="
+# define OPT_HUGEPAGES "--hugepages"
+# define OPT_TRACE "--trace="
+# define OPT_MONITORS "--monitors="
+# define OPT_METRICS "--metrics"
+# define MODE_THREADS 0
+# define MODE_TASKS 1
+# define MODE_SIMULATE 2
+/*  TASKS  */
+# define TASK_START 0
+# define TASK_TAKE_FIRST 1
+# define TASK_TAKE_SECOND 2
+# define TASK_EAT 3
+# define TASK_DONE_EATING 4
+# define TASK_SLEEP 5
+# define TASK_THINK 6
+# define TASK_CHECK 7
+# define TASK_CONTINUE 0
+# define TASK_PARKED 1
+# define TASK_DONE 2
+# define WORKER_IDLE_US 1000
+/*  STRATEGIES  */
+# define STRATEGY_ODDEVEN 0
+# define STRATEGY_HIERARCHY 1
+# define STRATEGY_WAITER 2
+# define STRATEGY_CHANDY 3
+# define STRATEGY_COUNT 4
+# define CHANDY_DIRTY 1
+# define CHANDY_REQUESTED 2
+# define CHANDY_STATE_SHIFT 4
+# define CHANDY_POLL_US 1000
+/*  SCHEDULE  */
+# define SCHEDULE_STATIC 0
+# define SCHEDULE_HUNGER 1
+# define SCHEDULE_STATIC_NAME "static"
+# define SCHEDULE_HUNGER_NAME "hunger"
+# define HUNGRY 1
+# define FED 0
+/*  FORK LOCKS  */
+# define LOCK_PTHREAD 0
+# define LOCK_FUTEX 1
+# define LOCK_TICKET 2
+# define LOCK_MCS 3
+# define LOCK_COUNT 4
+# define LOCK_SPIN 100
+# define FUTEX_LOCK_FREE 0
+# define FUTEX_LOCK_TAKEN 1
+# define FUTEX_LOCK_CONTENDED 2
+# define MCS_MAX_HELD 2
+# define MCS_WAITING 1
+# define MCS_PARKED 2
+/*  STARTUP  */
+# define STACK_DEFAULT_KB 64
+# define KB_TO_BYTES 1024
+# define SPAWN_BATCH 64
+# define GATE_CLOSED 0
+# define GATE_OPEN 1
+# define START_GATE_TIMEOUT_US 10000000
+# define NO_MEAL_YET -1
+/*  AFFINITY  */
+# define TOPO_SYSFS "/sys/devices/system/cpu/cpu%d/%s"
+# define TOPO_PACKAGE "topology/physical_package_id"
+# define TOPO_LLC "cache/index3/id"
+# define TOPO_CORE "topology/core_id"
+# define TOPO_PATH_SIZE 96
+# define TOPO_VALUE_SIZE 24
+# define TOPO_SPAN 4096
+# define AFFINITY_RESERVED 2
+# define AFFINITY_MONITOR -1
+# define AFFINITY_FLUSHER -2
+/*  PARTITIONS  */
+# define SHM_NAME "/philo-%d"
+# define SHM_NAME_LEN 32
+# define SHM_MODE 0600
+/*  METRICS  */
+# define METRICS_NAME "/philo-metrics-%d"
+# define METRICS_INTERVAL_US 100000
+# define METRICS_RATE_US 1000000
+# define ERR_METRICS "philo: --metrics: cannot publish %s\n"
+/*  ARENA  */
+# define HUGE_PAGE_SIZE 2097152
+# define ARENA_PAGES_SMALL 0
+# define ARENA_PAGES_HUGETLB 1
+# define ARENA_PAGES_THP 2
+# define ARENA_SMALL_NAME "4k"
+# define ARENA_HUGETLB_NAME "hugetlb"
+# define ARENA_THP_NAME "thp"
+# define PARTITION_GRACE_US 1000000
+# define PARTITION_POLL_US 1000
+# define PARTITION_SIGNALED "partition %d (philosophers %d-%d) ended by \
+signal %d\n"
+/*  SIMULATION  */
+# define SIM_DEFAULT_SEED 1
+# define SIM_NO_HORIZON -1
+# define SIM_TIE_BITS 16
+# define SIM_TIE_MASK 0xffff
+# define SIM_LCG_MUL 6364136223846793005UL
+# define SIM_LCG_INC 1442695040888963407UL
+# define SIM_TIE_SHIFT 48
+/*  HISTOGRAMS  */
+# ifdef PHILO_HISTO
+#  define HISTO_ENABLED 1
+# else
+#  define HISTO_ENABLED 0
+# endif
+# define HISTO_SUB_BITS 3
+# define HISTO_SUB_BUCKETS 8
+# define HISTO_BUCKETS 488
+# define HISTO_P50 500
+# define HISTO_P99 990
+# define HISTO_PERMILLE 1000
+# define HISTO_DEATH "death_latency"
+# define HISTO_SLEEP "sleep_overshoot"
+# define HISTO_FORK_TO_EAT "fork_to_eat"
+# define HISTO_FORMAT "histo: %-16s n=%-8lu p50=%ldus p99=%ldus max=%ldus\n"
+/*  PROFILE  */
+# ifdef PHILO_PROFILE
+#  define PROFILE_ENABLED 1
+# else
+#  define PROFILE_ENABLED 0
+# endif
+# define PROFILE_MUTEXES 1
+# define PROFILE_CONTENDED_NS 1000
+# define PROFILE_ROWS 16
+# define PROFILE_NAME_LEN 24
+# define PROFILE_WRITE "write"
+# define PROFILE_FORK "fork %d"
+# define PROFILE_HEADER "profile: %-10s %10s %10s %8s %8s %8s %8s %8s %8s\n"
+# define PROFILE_ROW "profile: %-10s %10lu %10lu %8ld %8ld %8ld %8ld %8ld \
+%8ld\n"
+# define PROFILE_FORKS "profile: %d forks, %lu acquisitions, %lu contended, \
+%d hottest shown\n"
+/*  STATS  */
+# define STATS_MODE_THREADS "threads"
+# define STATS_MODE_TASKS "tasks"
+# define STATS_MODE_SIMULATE "simulate"
+# define STATS_MODE_PROCESSES "processes"
+# define STATS_STARTUP "stats: startup %ld us, last thread %ld us after \
+release, first meals %ld-%ld us\n"
+# define STATS_AFFINITY "stats: affinity %d cpus, seats on %d, monitor cpu %d, \
+flusher cpu %d\n"
+# define STATS_ARENA "stats: arena %zu/%zu KiB, %s pages, %ld minor faults, \
+max rss %ld KiB\n"
+# define STATS_STOP "stats: stop (%s) at %ld us, last thread joined %ld us \
+later\n"
+# define STATS_STOP_DIED "death"
+# define STATS_STOP_FED "all fed"
+# define STATS_SIM "stats: %ld ms simulated, %ld events\n"
+# define STATS_FORKS "stats: strategy %s, fork wait avg %ld us max %ld us, \
+min slack %ld us\n"
+# define STATS_LOCK "stats: lock %s, %zu bytes per lock, %zu per fork, \
+neighbour wait gap %ld us\n"
+# define STATS_RUN "stats: %s, %d seats, %ld meals in %ld ms (%.0f meals/s)\n"
+# define STATS_SWITCHES "stats: %ld voluntary, %ld involuntary switches, \
+%ld task switches\n"
 /*  ERR  */
 # define ERR_ARGS "Problem with args\n"
 # define ERR_ALLOC "Problem with allocations\n"
@@ -96,49 +336,486 @@
 /*  TYPEDEF STRUCT  */
 struct	s_data;
 
+typedef struct s_log_record
+{
+	long			time;
+	int				id;
+	int				event;
+}				t_log_record;
+
+typedef struct s_arena
+{
+	void			*base;
+	size_t			size;
+	size_t			used;
+	int				shared;
+	int				pages;
+}				t_arena;
+
+typedef struct s_spawner
+{
+	struct s_data	*data;
+	pthread_t		thread;
+	int				first;
+	int				last;
+	int				error;
+}				t_spawner;
+
+typedef struct s_affinity
+{
+	int				*cpus;
+	int				n_cpus;
+	int				reserved;
+}				t_affinity;
+
+typedef struct s_trace
+{
+	int				fd;
+	unsigned char	*window;
+	size_t			offset;
+	size_t			used;
+	long			last;
+}				t_trace;
+
+typedef struct s_log
+{
+	t_log_record	*ring;
+	pthread_t		flusher;
+	atomic_int		running;
+	atomic_ulong	dropped;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	t_trace			trace;
+	char			*out;
+	size_t			out_len;
+	atomic_ulong	head __attribute__((aligned(CACHE_LINE)));
+	unsigned long	backpressured;
+	atomic_ulong	tail __attribute__((aligned(CACHE_LINE)));
+}				t_log;
+
+typedef struct s_deadline
+{
+	long			deadline;
+	int				index;
+}				t_deadline;
+
+typedef struct s_deadline_heap
+{
+	t_deadline		*nodes;
+	int				size;
+}				t_deadline_heap;
+
+typedef struct s_histo
+{
+	atomic_ulong	count;
+	atomic_long		max;
+	atomic_ulong	buckets[HISTO_BUCKETS];
+}				t_histo;
+typedef struct s_histos
+{
+	t_histo			death;
+	t_histo			sleep;
+	t_histo			fork_to_eat;
+}				t_histos;
+typedef struct s_lock_profile
+{
+	atomic_ulong	acquired;
+	atomic_ulong	contended;
+	long			held_at;
+	t_histo			wait;
+	t_histo			hold;
+}				t_lock_profile;
 typedef struct s_rules
 {
 	int				n_philo;
-	int				t_die;
-	int				t_eat;
-	int				t_sleep;
-	int				t_think;
+	long			t_die;
+	long			t_eat;
+	long			t_sleep;
+	long			t_think;
 }				t_rules;
 
+typedef struct s_mcs_node
+{
+	struct s_mcs_node *_Atomic	next;
+	atomic_int					locked;
+	int							in_use;
+}				t_mcs_node;
+typedef struct s_ticket_lock
+{
+	atomic_int		next;
+	atomic_int		serving;
+	atomic_int		waiting;
+}				t_ticket_lock;
+typedef struct s_mcs_lock
+{
+	t_mcs_node *_Atomic	tail;
+	t_mcs_node			*holder;
+}				t_mcs_lock;
+typedef union u_fork_lock
+{
+	pthread_mutex_t	mutex;
+	atomic_int		futex;
+	t_ticket_lock	ticket;
+	t_mcs_lock		mcs;
+}				t_fork_lock;
+typedef struct s_lock_ops
+{
+	const char		*name;
+	size_t			size;
+	int				(*init)(t_fork_lock *lock, int shared);
+	int				(*lock)(t_fork_lock *lock, atomic_int *stop);
+	void			(*unlock)(t_fork_lock *lock);
+	int				(*destroy)(t_fork_lock *lock);
+}				t_lock_ops;
+
+typedef struct s_fork
+{
+	t_fork_lock		lock;
+	int				taken;
+	struct s_task	*waiter;
+	atomic_int		state;
+}				__attribute__((aligned(CACHE_LINE))) t_fork;
+
 typedef struct s_philo
 {
+	atomic_long		last_meal;
+	atomic_int		remaining_meal;
 	int				id;
-	int				remaining_meal;
-	long			last_meal;
-	t_rules			individual_rules;
+	int				eating;
+	atomic_int		hungry;
+	atomic_long		meals_eaten;
+	const t_rules	*rules;
 	struct s_data	*shared_data;
-}				t_philo;
+	long			hungry_at;
+	atomic_long		wait_total;
+	long			wait_max;
+	atomic_long		min_slack;
+	long			started_at;
+	long			first_meal;
+}				__attribute__((aligned(CACHE_LINE))) t_philo;
+typedef struct s_strategy
+{
+	const char		*name;
+	int				(*init)(struct s_data *data);
+	int				(*take)(t_philo *philo);
+	void			(*put)(t_philo *philo);
+}				t_strategy;
+typedef struct s_waiter
+{
+	pthread_mutex_t	lock;
+	pthread_cond_t	seat_freed;
+	int				seats;
+}				t_waiter;
 
+typedef struct s_options
+{
+	int				mode;
+	int				n_workers;
+	int				stats;
+	unsigned long	seed;
+	long			until;
+	int				strategy;
+	int				lock;
+	int				schedule;
+	int				n_procs;
+	int				affinity;
+	long			stack_size;
+	int				hugepages;
+	const char		*trace;
+	int				n_monitors;
+	int				metrics;
+}				t_options;
+typedef struct s_task
+{
+	struct s_task	*next;
+	t_philo			*philo;
+	int				state;
+	int				first_fork;
+	int				second_fork;
+	long			forks_at;
+}				t_task;
+typedef struct s_worker
+{
+	pthread_mutex_t	lock;
+	t_task			*head;
+	t_task			*tail;
+	t_deadline_heap	timers;
+	pthread_t		thread;
+	int				id;
+	long			switches;
+	struct s_data	*data;
+}				__attribute__((aligned(CACHE_LINE))) t_worker;
+typedef struct s_sched
+{
+	t_worker		*workers;
+	t_task			*tasks;
+	int				n_workers;
+	atomic_int		active;
+}				t_sched;
+typedef struct s_monitor
+{
+	t_deadline_heap	heap;
+	pthread_t		thread;
+	struct s_data	*data;
+	atomic_long		next_deadline;
+	atomic_int		watched;
+}				__attribute__((aligned(CACHE_LINE))) t_monitor;
+typedef struct s_metrics_philo
+{
+	long			last_meal_age;
+	long			slack;
+	long			meals;
+	long			fork_wait;
+}				t_metrics_philo;
+typedef struct s_metrics
+{
+	atomic_ulong	seq;
+	int				n_philo;
+	int				n_monitors;
+	int				stop;
+	int				watched;
+	long			now;
+	long			meals;
+	long			meals_per_sec;
+	long			min_slack;
+	long			fork_wait;
+	long			next_deadline;
+	t_metrics_philo	philo[];
+}				t_metrics;
+typedef struct s_publisher
+{
+	t_metrics		*shm;
+	size_t			size;
+	pthread_t		thread;
+	long			meals;
+	long			at;
+	char			name[SHM_NAME_LEN];
+}				t_publisher;
+typedef struct s_sim
+{
+	t_deadline_heap	events;
+	long			now;
+	unsigned long	seed;
+	long			n_events;
+}				t_sim;
 typedef struct s_data
 {
+	t_rules			global_rules;
 	long long		t0;
-	int				someone_died;
-	pthread_mutex_t	*forks;
+	long			sleep_tail;
+	atomic_int		someone_died;
+	atomic_int		start_gate;
+	atomic_int		ready;
+	atomic_int		finished;
+	long			startup_us;
+	long			stop_at;
+	t_fork			*forks;
 	t_philo			*philo;
 	pthread_t		*thread_ids;
-	pthread_mutex_t	shared_resource_mutex;
-	pthread_mutex_t	write;
-	t_rules			global_rules;
+	pid_t			*workers;
+	t_arena			arena;
+	t_affinity		affinity;
+	t_deadline_heap	deadlines;
+	t_monitor		*monitors;
+	t_options		opts;
+	t_sched			sched;
+	t_sim			sim;
+	t_publisher		publisher;
+	long			t_end;
+	t_histos		histos;
+	t_strategy		*strategy;
+	t_lock_ops		*locks;
+	t_lock_profile	*profiles;
+	t_waiter		waiter;
+	pthread_mutex_t	write __attribute__((aligned(CACHE_LINE)));
+	t_log			log;
 }				t_data;
 
 /*  PROTOTYPE  */
 void	*run_philosopher_routine(void *valise);
 long	get_time(long t0);
+long	table_now(t_data *data);
 int		init(t_data *data, char **argv);
 void	check_philosopher_life(t_data *data);
 int		ft_atoi(const char *nptr);
 void	printf_meal(t_philo *philo);
 void	ft_usleep(t_data *data, long duration);
+void	sleep_until(t_data *data, long deadline);
+void	calibrate_sleep_tail(t_data *data);
+void	futex_wait_until(atomic_int *word, int expected, long deadline);
+void	futex_wake_all(atomic_int *word);
+void	start_meal(t_philo *philo);
+void	finish_meal(t_philo *philo);
+void	log_action(t_philo *philo, int event);
+void	get_fork_order(t_philo *philo, int *first_fork, int *second_fork);
+void	note_hungry(t_philo *philo);
+int		parse_strategy(const char *name, t_options *opts);
+t_strategy	*get_strategy(int id);
+int		ordered_take(t_philo *philo);
+void	ordered_put(t_philo *philo);
+void	strategy_wake(t_data *data);
+int		waiter_init(t_data *data);
+int		waiter_sit(t_data *data);
+void	waiter_stand(t_data *data);
+int		waiter_take(t_philo *philo);
+void	waiter_put(t_philo *philo);
+int		waiter_destroy(t_data *data);
+int		parse_schedule(const char *name, t_options *opts);
+int		philo_outranks(t_philo *a, t_philo *b);
+t_philo	*hungrier_neighbour(t_philo *philo);
+void	yield_to_hungrier(t_philo *philo);
+void	clear_hunger(t_philo *philo);
+t_lock_ops	*get_fork_lock(int id);
+int		parse_fork_lock(const char *name, t_options *opts);
+int		fork_lock(t_data *data, t_fork *fork, atomic_int *stop);
+void	fork_unlock(t_data *data, t_fork *fork);
+int		word_lock_init(t_fork_lock *lock, int shared);
+int		shared_mutex_init(pthread_mutex_t *mutex, int shared);
+void	shared_mutex_lock(pthread_mutex_t *mutex);
+void	write_lock(t_data *data);
+void	write_unlock(t_data *data);
+int		mutex_lock_init(t_fork_lock *lock, int shared);
+int		mutex_lock_acquire(t_fork_lock *lock, atomic_int *stop);
+void	mutex_lock_release(t_fork_lock *lock);
+int		mutex_lock_destroy(t_fork_lock *lock);
+void	futex_wait(atomic_int *word, int expected);
+void	futex_wait_stop(atomic_int *word, int expected, atomic_int *stop);
+void	futex_wake_one(atomic_int *word);
+int		futex_lock_acquire(t_fork_lock *lock, atomic_int *stop);
+void	futex_lock_release(t_fork_lock *lock);
+int		ticket_lock_wait(t_fork_lock *lock, int ticket, atomic_int *stop);
+int		ticket_lock_acquire(t_fork_lock *lock, atomic_int *stop);
+void	ticket_lock_release(t_fork_lock *lock);
+t_mcs_node	*mcs_node_get(void);
+int		mcs_lock_acquire(t_fork_lock *lock, atomic_int *stop);
+void	mcs_lock_release(t_fork_lock *lock);
+int		chandy_init(t_data *data);
+int		chandy_request(t_philo *philo, t_fork *fork);
+int		chandy_try_eat(t_philo *philo, int left, int right);
+void	chandy_hand_over(t_philo *philo, int f);
+int		chandy_take(t_philo *philo);
+void	chandy_put(t_philo *philo);
+void	deadline_heap_sift_down(t_deadline_heap *heap, int i);
+void	deadline_heap_build(t_data *data, t_deadline_heap *heap, int first);
+void	deadline_heap_pop(t_deadline_heap *heap);
 void	print_meal(t_philo *philo);
 int		should_philo_continue(t_data *data, t_philo *philo);
 int		init_philosopher_rules(t_data *data, t_rules rules);
 void	*ft_memset(void *s, int c, size_t n);
 int		cleanup_and_end(t_data *data);
 long	ft_atol(const char *nptr);
+long	ft_atous(const char *nptr);
+int		wait_log_space(t_data *data, unsigned long head);
+void	log_push(t_data *data, long time, int id, int event);
+void	log_wake_flusher(t_log *log);
+void	*run_log_flusher(void *valise);
+int		log_init(t_log *log, int shared, const char *trace);
+int		log_start(t_log *log);
+int		log_stop(t_log *log);
+int		log_destroy(t_log *log);
+int		is_valid_number(const char *arg, int allow_fraction);
+int		check_arg(int argc, char **argv);
+void	print_reports(t_data *data);
+int		parse_options(int argc, char **argv, t_options *opts);
+int		create_philosopher_range(t_data *data, int first, int last);
+void	*run_spawner(void *valise);
+int		join_spawners(t_spawner *spawners, int n);
+int		launch_spawners(t_data *data, t_spawner *spawners, int n);
+int		create_philosopher_threads(t_data *data);
+void	wait_start_gate(t_philo *philo);
+void	open_start_gate(t_data *data);
+void	print_startup_stats(t_data *data);
+int		parse_stack_size(const char *value, t_options *opts);
+void	print_table_stats(t_data *data, long meals);
+int		join_philosopher_threads(t_data *data);
+int		start_philosophers(t_data *data);
+int		join_philosophers(t_data *data);
+size_t	arena_round(size_t size);
+size_t	arena_size(t_options *opts, int n);
+t_data	*arena_map(t_data *data, int n_philo);
+void	*arena_alloc(t_data *data, size_t size);
+void	arena_unmap(t_data *data);
+void	*shm_segment(size_t size);
+void	*private_segment(size_t *size, int hugepages, int *pages);
+void	print_arena_stats(t_data *data);
+void	run_partition(t_data *data, int index);
+int		start_partitions(t_data *data);
+int		reap_partition(t_data *data, int index, long deadline);
+int		join_partitions(t_data *data);
+int		parse_processes(const char *value, t_options *opts);
+int		parse_monitors(const char *value, t_options *opts);
+void	split_monitors(t_data *data);
+void	*run_monitor(void *valise);
+void	watch_deadlines(t_monitor *shard);
+void	signal_all_fed(t_data *data);
+void	print_stop_stats(t_data *data);
+long	read_topology(int cpu, const char *file);
+long	topology_key(int cpu);
+void	sort_cpus(int *cpus, long *keys, int n);
+int		list_cpus(cpu_set_t *set, int *cpus, long *keys);
+int		init_affinity(t_data *data);
+int		affinity_cpu(t_data *data, int slot, int count);
+void	affinity_pin(t_data *data, pthread_t thread, int slot, int count);
+void	print_affinity_stats(t_data *data);
+void	print_fork_stats(t_data *data, long meals);
+long	average_wait(t_philo *philo);
+long	neighbour_wait_gap(t_data *data);
+void	print_lock_stats(t_data *data);
+char	*stats_mode_name(t_data *data);
+void	print_stats(t_data *data);
+void	histo_record(t_histo *histo, long value);
+long	histo_percentile(t_histo *histo, int permille);
+void	print_histo(const char *name, t_histo *histo);
+void	print_histograms(t_data *data);
+void	deadline_heap_push(t_deadline_heap *heap, long deadline, int index);
+int		init_tasks(t_data *data);
+int		init_workers(t_data *data);
+int		init_task_scheduler(t_data *data);
+int		start_task_scheduler(t_data *data);
+int		join_task_scheduler(t_data *data);
+void	destroy_task_scheduler(t_data *data);
+long	count_task_switches(t_data *data);
+void	push_task(t_worker *worker, t_task *task);
+void	*run_task_worker(void *valise);
+int		arm_task_timer(t_worker *worker, t_task *task, long duration);
+void	release_due_timers(t_worker *worker, long now);
+int		acquire_task_fork(t_data *data, t_task *task, int i);
+void	release_task_fork(t_worker *worker, int i);
+int		take_task_forks(t_data *data, t_task *task);
+void	run_task_step(t_worker *worker, t_task *task);
+int		init_simulation(t_data *data);
+void	sim_schedule(t_data *data, long time, int index);
+int		sim_wait(t_data *data, t_task *task, long duration);
+int		run_simulation(t_data *data);
+void	run_sim_step(t_data *data, t_task *task);
+size_t	format_long(char *out, long value);
+const char	*log_event_text(int event, size_t *len);
+size_t	format_log_record(char *out, t_log_record *record);
+void	print_log_record(t_log *log, t_log_record *record);
+int		flush_log_output(t_log *log);
+void	emit_log_record(t_log *log, t_log_record *record);
+int		trace_open(t_trace *trace, const char *path);
+int		trace_map(t_trace *trace);
+size_t	trace_varint(unsigned char *out, unsigned long value);
+int		trace_append(t_trace *trace, t_log_record *record);
+int		trace_close(t_trace *trace);
+int		metrics_open(t_data *data);
+void	metrics_close(t_data *data);
+void	metrics_start(t_data *data);
+void	*run_metrics(void *valise);
+void	metrics_stop(t_data *data);
+void	sample_philos(t_data *data, long now);
+void	sample_monitors(t_data *data);
+void	update_meal_rate(t_data *data, long now);
+void	publish_metrics(t_data *data);
+int		profile_init(t_data *data);
+long	profile_now(void);
+void	profile_acquired(t_lock_profile *profile, long asked_at);
+void	profile_released(t_lock_profile *profile);
+int		is_hotter(t_lock_profile *a, t_lock_profile *b);
+int		select_hot_forks(t_data *data, int *hot, int rows);
+void	print_profile_row(const char *name, t_lock_profile *profile);
+void	print_fork_totals(t_data *data, int shown);
+void	print_profile(t_data *data);
 
 #endif
\ No newline at end of file
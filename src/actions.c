@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   actions.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:12 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 13:05:12 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function start_meal
+ * @brief Commence un repas : horodatage et journalisation.
+ *
+ * @param philo: Pointeur vers la structure t_philo.
+ *
+ * @description Publie last_meal et journalise les deux fourchettes et
+ * le repas. L'horodatage est pris sous le mutex d'écriture pour que le
+ * journal reste ordonné. Ne dort pas : utilisable par un thread comme
+ * par une tâche. Met à jour les mesures de --stats, écrites par le seul
+ * philosophe : attente depuis note_hungry et marge restante avant
+ * t_die au moment de manger. Le cumul et la marge minimale sont des
+ * atomiques relâchés, lisibles par --metrics sans verrou.
+ *
+ * @return void
+ *
+ * @errors/edge_effects last_meal est publié en release pour que le
+ * moniteur, qui le lit en acquire, voie un horodatage cohérent.
+ *
+ * @examples start_meal(philo_ptr);
+ *
+ * @dependencies Dépend de get_time et print_meal.
+ *
+ * @control_flow 1. Publication de last_meal sous le mutex d'écriture.
+ *               2. Journalisation du repas.
+ *               3. Marge minimale et attente des fourchettes.
+ */
+void	start_meal(t_philo *philo)
+{
+	long	now;
+	long	slack;
+
+	write_lock(philo->shared_data);
+	now = get_time(philo->shared_data->t0);
+	if (philo->first_meal == NO_MEAL_YET)
+		philo->first_meal = now;
+	slack = atomic_load_explicit(&philo->last_meal, memory_order_relaxed)
+		+ philo->rules->t_die - now;
+	atomic_store_explicit(&philo->last_meal, now, memory_order_release);
+	print_meal(philo);
+	write_unlock(philo->shared_data);
+	if (slack < atomic_load_explicit(&philo->min_slack, memory_order_relaxed))
+		atomic_store_explicit(&philo->min_slack, slack, memory_order_relaxed);
+	now -= philo->hungry_at;
+	atomic_store_explicit(&philo->wait_total, now + atomic_load_explicit(
+			&philo->wait_total, memory_order_relaxed), memory_order_relaxed);
+	if (now > philo->wait_max)
+		philo->wait_max = now;
+}
+
+/**
+ * @function finish_meal
+ * @brief Termine un repas : décompte des repas.
+ *
+ * @param philo: Pointeur vers la structure t_philo.
+ *
+ * @description Réduit remaining_meal et compte le repas pour les
+ * statistiques. meals_eaten n'est écrit que par son propriétaire, par
+ * une simple écriture relâchée : --metrics le lit en cours de route.
+ * Le repas qui atteint le quota compte une fois le philosophe dans
+ * finished ; le dernier à l'atteindre termine la table.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Sans quota, remaining_meal part de
+ * UNLIMITED_MEALS et ne passe jamais de 1 à 0.
+ *
+ * @examples finish_meal(philo_ptr);
+ *
+ * @dependencies Dépend de atomic_fetch_sub_explicit,
+ * atomic_fetch_add_explicit et signal_all_fed.
+ *
+ * @control_flow 1. Compter le repas, avant tout arrêt, pour que le
+ *                  dernier instantané de --metrics l'inclue.
+ *               2. Réduire atomiquement remaining_meal.
+ *               3. Au quota, compter le philosophe et, s'il est le
+ *                  dernier, arrêter la table.
+ */
+void	finish_meal(t_philo *philo)
+{
+	atomic_store_explicit(&philo->meals_eaten, 1 + atomic_load_explicit(
+			&philo->meals_eaten, memory_order_relaxed), memory_order_relaxed);
+	if (atomic_fetch_sub_explicit(&philo->remaining_meal, 1,
+			memory_order_release) == 1
+		&& atomic_fetch_add_explicit(&philo->shared_data->finished, 1,
+			memory_order_acq_rel) + 1 == philo->rules->n_philo)
+		signal_all_fed(philo->shared_data);
+}
+
+/**
+ * @function log_action
+ * @brief Journalise une action du philosophe sans attendre.
+ *
+ * @param philo: Pointeur vers la structure t_philo.
+ * @param event: Code LOG_EV_* de l'action.
+ *
+ * @description Verrouille le mutex de l'écriture, vérifie si le
+ * philosophe doit continuer et journalise l'action. Un philosophe seul
+ * ne journalise rien.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucune ligne ne peut suivre "died" : la mort
+ * est publiée avant que le moniteur ne prenne ce même mutex.
+ *
+ * @examples log_action(philo_ptr, LOG_EV_SLEEPING);
+ *
+ * @dependencies Dépend de should_philo_continue et log_push.
+ *
+ * @control_flow 1. Verrouiller le mutex.
+ *               2. Vérifier la condition de continuation.
+ *               3. Journaliser et déverrouiller.
+ */
+void	log_action(t_philo *philo, int event)
+{
+	write_lock(philo->shared_data);
+	if (!should_philo_continue(philo->shared_data, philo)
+		&& philo->rules->n_philo > 1)
+		log_push(philo->shared_data, get_time(philo->shared_data->t0),
+			philo->id, event);
+	write_unlock(philo->shared_data);
+}
+
+/**
+ * @function get_fork_order
+ * @brief Détermine l'ordre de prise des fourchettes.
+ *
+ * @param philo: Pointeur vers la structure t_philo.
+ * @param first_fork: Reçoit l'index de la première fourchette.
+ * @param second_fork: Reçoit l'index de la seconde fourchette.
+ *
+ * @description Un philosophe pair prend d'abord sa fourchette de
+ * gauche, un impair celle de droite : deux voisins ne peuvent pas
+ * s'attendre mutuellement. Avec --strategy=hierarchy, chacun prend
+ * d'abord la fourchette de plus petit index : seul le dernier commence
+ * par sa droite, la fourchette 0.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples get_fork_order(philo_ptr, &first, &second);
+ *
+ * @dependencies Aucune dépendance externe.
+ *
+ * @control_flow 1. Hiérarchie : plus petit index d'abord.
+ *               2. Sinon tester la parité de l'id.
+ *               3. Affecter les deux index.
+ */
+void	get_fork_order(t_philo *philo, int *first_fork, int *second_fork)
+{
+	if (philo->shared_data->opts.strategy == STRATEGY_HIERARCHY
+		&& philo->id == philo->rules->n_philo)
+	{
+		*first_fork = 0;
+		*second_fork = philo->id - 1;
+	}
+	else if (philo->shared_data->opts.strategy == STRATEGY_HIERARCHY
+		|| philo->id % 2 == 0)
+	{
+		*first_fork = philo->id - 1;
+		*second_fork = philo->id % philo->rules->n_philo;
+	}
+	else
+	{
+		*first_fork = philo->id % philo->rules->n_philo;
+		*second_fork = philo->id - 1;
+	}
+}
+
+/**
+ * @function note_hungry
+ * @brief Note l'instant où un philosophe commence à chercher ses
+ * fourchettes.
+ *
+ * @param philo: Pointeur vers la structure t_philo.
+ *
+ * @description Point de départ de l'attente des fourchettes mesurée par
+ * start_meal, quelle que soit la stratégie. Avec --simulate, l'heure
+ * est le temps virtuel.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples note_hungry(philo);
+ *
+ * @dependencies Dépend de table_now.
+ *
+ * @control_flow 1. Horodatage.
+ */
+void	note_hungry(t_philo *philo)
+{
+	philo->hungry_at = table_now(philo->shared_data);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   affinity.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:41:05 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 21:41:05 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        affinity_cpu
+ * @brief           CPU attribué à une place ou à un thread de service.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param int       slot - Indice de la place, AFFINITY_MONITOR ou
+ *                  AFFINITY_FLUSHER.
+ * @param int       count - Nombre de places.
+ * 
+ * @description     Les places se partagent les CPU non réservés en blocs
+ *                  contigus de l'ordre de topologie : deux places
+ *                  voisines, qui partagent une fourchette, tombent sur le
+ *                  même cœur ou le même LLC. Le moniteur prend le dernier
+ *                  CPU, le thread de vidage le premier réservé ; avec un
+ *                  seul réservé, ils le partagent.
+ * 
+ * @return          Le numéro du CPU.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         cpu = affinity_cpu(data, AFFINITY_MONITOR, 0);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Threads de service.
+ *                  2. Bloc de la place.
+ */
+int	affinity_cpu(t_data *data, int slot, int count)
+{
+	int	seats;
+
+	seats = data->affinity.n_cpus - data->affinity.reserved;
+	if (slot == AFFINITY_FLUSHER && data->affinity.reserved)
+		return (data->affinity.cpus[seats]);
+	if (slot < 0)
+		return (data->affinity.cpus[data->affinity.n_cpus - 1]);
+	return (data->affinity.cpus[(long)slot * seats / count]);
+}
+
+/**
+ * @function        affinity_pin
+ * @brief           Épingle un thread sur son CPU (--affinity).
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param pthread_t thread - Le thread.
+ * @param int       slot - Voir affinity_cpu.
+ * @param int       count - Nombre de places.
+ * 
+ * @description     Sans --affinity, le placement reste au noyau.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Modifie l'affinité du thread. Un échec laisse le
+ *                  placement au noyau.
+ * 
+ * @example         affinity_pin(data, pthread_self(), philo->id - 1, n);
+ * 
+ * @dependencies    affinity_cpu, pthread_setaffinity_np
+ * 
+ * @control_flow    1. Construction de l'ensemble d'un seul CPU.
+ *                  2. Application.
+ */
+void	affinity_pin(t_data *data, pthread_t thread, int slot, int count)
+{
+	cpu_set_t	set;
+
+	if (!data->affinity.cpus)
+		return ;
+	CPU_ZERO(&set);
+	CPU_SET(affinity_cpu(data, slot, count), &set);
+	pthread_setaffinity_np(thread, sizeof(cpu_set_t), &set);
+}
+
+/**
+ * @function        print_affinity_stats
+ * @brief           Affiche le placement choisi pour --stats.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Nombre de CPU autorisés, CPU des places, du moniteur
+ *                  et du thread de vidage. Rien sans --affinity.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Impression sur stderr.
+ * 
+ * @example         print_affinity_stats(data);
+ * 
+ * @dependencies    affinity_cpu
+ * 
+ * @control_flow    1. Impression.
+ */
+void	print_affinity_stats(t_data *data)
+{
+	if (!data->affinity.cpus)
+		return ;
+	fprintf(stderr, STATS_AFFINITY, data->affinity.n_cpus,
+		data->affinity.n_cpus - data->affinity.reserved,
+		affinity_cpu(data, AFFINITY_MONITOR, 0),
+		affinity_cpu(data, AFFINITY_FLUSHER, 0));
+}
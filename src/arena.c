@@ -0,0 +1,211 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:58:14 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 22:58:14 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function arena_round
+ * @brief Arrondit une taille au multiple de CACHE_LINE supérieur.
+ *
+ * @param size: Taille en octets.
+ *
+ * @description Chaque bloc de l'arène commence sur sa propre ligne de
+ * cache, comme avec aligned_alloc.
+ *
+ * @return size_t: La taille arrondie.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples size = arena_round(sizeof(t_data));
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Arrondir.
+ */
+size_t	arena_round(size_t size)
+{
+	return ((size + CACHE_LINE - 1) & ~((size_t)CACHE_LINE - 1));
+}
+
+/**
+ * @function arena_size
+ * @brief Taille de l'arène d'une table de n philosophes.
+ *
+ * @param opts: Options de la ligne de commande.
+ * @param n: Nombre de philosophes.
+ *
+ * @description Somme de tous les tableaux par table : philosophes,
+ * fourchettes, anneau et tampon de sortie du journal, identifiants de
+ * thread, tas d'échéances et moniteurs, plus t_data avec --processes,
+ * les tâches avec --tasks ou --simulate, les ouvriers et leurs
+ * minuteurs avec --tasks et la file d'événements avec --simulate.
+ * Un binaire make profile ajoute les profils des verrous.
+ *
+ * @return size_t: La taille en octets.
+ *
+ * @errors/edge_effects Doit suivre chaque arena_alloc de l'init.
+ *
+ * @examples size = arena_size(&data->opts, n);
+ *
+ * @dependencies Dépend de arena_round.
+ *
+ * @control_flow 1. Tableaux communs.
+ *               2. Tableaux propres au mode.
+ */
+size_t	arena_size(t_options *opts, int n)
+{
+	size_t	size;
+	size_t	workers;
+
+	size = arena_round(sizeof(t_philo) * n) + arena_round(sizeof(t_fork) * n)
+		+ arena_round(sizeof(t_log_record) * LOG_RING_SIZE)
+		+ arena_round(LOG_OUT_SIZE)
+		+ arena_round(sizeof(pthread_t) * n)
+		+ arena_round(sizeof(t_deadline) * n)
+		+ arena_round(sizeof(t_monitor) * opts->n_monitors);
+	if (opts->n_procs > 1)
+		size += arena_round(sizeof(t_data));
+	if (PROFILE_ENABLED)
+		size += arena_round(sizeof(t_lock_profile) * (n + PROFILE_MUTEXES));
+	if (opts->mode != MODE_THREADS)
+		size += arena_round(sizeof(t_task) * n);
+	if (opts->mode == MODE_SIMULATE)
+		size += arena_round(sizeof(t_deadline) * n * 2);
+	workers = opts->n_workers;
+	if (workers > (size_t)n)
+		workers = n;
+	if (opts->mode == MODE_TASKS)
+		size += arena_round(sizeof(t_worker) * workers)
+			+ workers * arena_round(sizeof(t_deadline) * n);
+	return (size);
+}
+
+/**
+ * @function arena_map
+ * @brief Projette l'arène d'où vient tout l'état de la table.
+ *
+ * @param data: Données lues depuis la ligne de commande.
+ * @param n_philo: Nombre de philosophes.
+ *
+ * @description Un seul mmap pour tous les tableaux de la table, et un
+ * seul munmap à la fin. Avec --processes, l'arène est un segment
+ * shm_open projeté avant fork() et t_data y est copié : les processus
+ * ouvriers la voient à la même adresse, donc les pointeurs internes
+ * restent valides. Avec --hugepages, l'arène privée est en pages
+ * énormes, ou à défaut en pages énormes transparentes.
+ *
+ * @return t_data*: data, ou sa copie dans l'arène avec --processes,
+ * NULL en cas d'échec.
+ *
+ * @errors/edge_effects Les N de --processes et de --monitors sont
+ * ramenés au nombre de philosophes.
+ *
+ * @examples data = arena_map(&local, ft_atoi(argv[1]));
+ *
+ * @dependencies Dépend de arena_size, shm_segment et private_segment.
+ *
+ * @control_flow 1. Projeter l'arène, partagée ou privée.
+ *               2. Y copier data si partagée et préparer l'allocateur.
+ */
+t_data	*arena_map(t_data *data, int n_philo)
+{
+	t_arena	arena;
+
+	if (data->opts.n_procs > n_philo)
+		data->opts.n_procs = n_philo;
+	if (data->opts.n_monitors > n_philo)
+		data->opts.n_monitors = n_philo;
+	arena.size = arena_size(&data->opts, n_philo);
+	arena.shared = data->opts.n_procs > 1;
+	arena.pages = ARENA_PAGES_SMALL;
+	if (arena.shared)
+		arena.base = shm_segment(arena.size);
+	else
+		arena.base = private_segment(&arena.size, data->opts.hugepages,
+				&arena.pages);
+	if (arena.base == MAP_FAILED)
+		return (NULL);
+	arena.used = 0;
+	if (arena.shared)
+	{
+		memcpy(arena.base, data, sizeof(t_data));
+		data = arena.base;
+		arena.used = arena_round(sizeof(t_data));
+	}
+	data->arena = arena;
+	return (data);
+}
+
+/**
+ * @function arena_alloc
+ * @brief Découpe un bloc dans l'arène de la table.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param size: Taille en octets.
+ *
+ * @description Allocation par pointeur croissant, sans libération
+ * individuelle : tout part avec arena_unmap. Les blocs sont alignés
+ * sur CACHE_LINE et mis à zéro par mmap.
+ *
+ * @return void*: Le bloc, ou NULL si l'arène est épuisée.
+ *
+ * @errors/edge_effects NULL si arena_size a oublié un tableau.
+ *
+ * @examples data->forks = arena_alloc(data, sizeof(t_fork) * n);
+ *
+ * @dependencies Dépend de arena_round.
+ *
+ * @control_flow 1. Vérifier la place restante.
+ *               2. Avancer dans l'arène.
+ */
+void	*arena_alloc(t_data *data, size_t size)
+{
+	void	*ptr;
+
+	size = arena_round(size);
+	if (data->arena.used + size > data->arena.size)
+		return (NULL);
+	ptr = (char *)data->arena.base + data->arena.used;
+	data->arena.used += size;
+	return (ptr);
+}
+
+/**
+ * @function arena_unmap
+ * @brief Libère d'un coup tout l'état de la table.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Avec --processes, data vit dans l'arène : base et
+ * taille sont copiées avant munmap, et data n'est plus utilisable
+ * après.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples arena_unmap(data);
+ *
+ * @dependencies Dépend de munmap.
+ *
+ * @control_flow 1. Copier base et taille.
+ *               2. Retirer la projection.
+ */
+void	arena_unmap(t_data *data)
+{
+	void	*base;
+	size_t	size;
+
+	base = data->arena.base;
+	size = data->arena.size;
+	munmap(base, size);
+}
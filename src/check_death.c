@@ -18,120 +18,230 @@
  *
  * @param data: Pointeur vers la structure t_data.
  * @param i: L'index du philosophe.
+ * @param deadline: L'échéance dépassée, last_meal + t_die, lue par le
+ * moniteur.
  * 
- * @description Cette fonction met à jour le flag 'someone_died' 
- * et imprime un message indiquant quel philosophe est mort.
+ * @description Cette fonction fait passer le flag 'someone_died' de
+ * NO_ONE_DIED à SOMEONE_DIED, réveille les threads endormis sur ce mot
+ * futex et journalise la mort, puis réveille le thread de vidage pour
+ * que la ligne sorte sans attendre le prochain lot.
  *
  * @return void
  * 
- * @errors/edge_effects La fonction prend les verrous pour éviter les
- * conflits. Ceci peut causer un blocage si mal utilisé.
+ * @errors/edge_effects Le flag est publié en release avant de prendre
+ * le mutex d'écriture : aucune ligne ne peut suivre "died". Avec
+ * plusieurs moniteurs, seul celui qui gagne la comparaison-échange
+ * imprime : les autres rendent la main sans rien écrire.
  *
- * @examples signal_and_print_death(data_ptr, 2);
+ * @examples signal_and_print_death(data_ptr, 2, top->deadline);
  *
- * @dependencies Nécessite l'accès à pthread_mutex_lock,
- * pthread_mutex_unlock et printf.
+ * @dependencies Nécessite l'accès à futex_wake_all, strategy_wake,
+ * write_lock, write_unlock, log_push, log_wake_flusher et histo_record.
  *
- * @control_flow 1. Prendre les mutex.
- *               2. Mettre à jour les données.
- *               3. Libérer les mutex.
+ * @control_flow 1. Publier someone_died, sauf si un autre moniteur l'a
+ *                  déjà fait, et réveiller les dormeurs.
+ *               2. Journaliser sous le mutex d'écriture.
+ *               3. Réveiller le thread de vidage.
+ *               4. Avec PHILO_HISTO, mesurer l'écart entre l'échéance
+ *                  et la ligne journalisée. L'échéance vient du moniteur :
+ *                  le mourant a pu saisir ses fourchettes entre-temps.
  */
-void	signal_and_print_death(t_data *data, int i)
+void	signal_and_print_death(t_data *data, int i, long deadline)
 {
-	pthread_mutex_lock(&data->shared_resource_mutex);
-	data->someone_died = SOMEONE_DIED;
-	pthread_mutex_unlock(&data->shared_resource_mutex);
-	pthread_mutex_lock(&data->write);
-	printf(LOG_DIED, get_time(data->t0), i);
-	pthread_mutex_unlock(&data->write);
+	long	now;
+	int		expected;
+
+	expected = NO_ONE_DIED;
+	if (!atomic_compare_exchange_strong_explicit(&data->someone_died,
+			&expected, SOMEONE_DIED, memory_order_acq_rel,
+			memory_order_acquire))
+		return ;
+	futex_wake_all(&data->someone_died);
+	strategy_wake(data);
+	write_lock(data);
+	now = get_time(data->t0);
+	log_push(data, now, i, LOG_EV_DIED);
+	data->stop_at = now;
+	write_unlock(data);
+	log_wake_flusher(&data->log);
+	if (HISTO_ENABLED)
+		histo_record(&data->histos.death, now - deadline);
 }
 
 /**
- * @function update_philosopher_data
- * @brief Met à jour les données d'un philosophe.
+ * @function signal_all_fed
+ * @brief Arrête la table quand tous les philosophes ont fini leurs repas.
  *
  * @param data: Pointeur vers la structure t_data.
- * @param iteration_meal_count: Pointeur vers le compteur de repas.
- * @param time_since_last_meal: Pointeur vers le temps depuis le dernier repas.
- * @param i: L'index du philosophe.
- * 
- * @description Met à jour les données associées à un philosophe.
- * Ceci inclut le nombre de repas restants et le temps écoulé
- * depuis le dernier repas.
+ *
+ * @description Fait passer someone_died de NO_ONE_DIED à ALL_FED et
+ * réveille les threads endormis sur ce mot futex : les philosophes
+ * sortent de leur sommeil, les moniteurs de leur attente d'échéance,
+ * et la jointure suit aussitôt au lieu d'attendre que chaque échéance
+ * soit passée.
  *
  * @return void
- * 
- * @errors/edge_effects Utilise les verrous pour prévenir les conflits.
  *
- * @examples update_philosopher_data(data_ptr, &count, &time, 2);
+ * @errors/edge_effects Sans effet si une mort a déjà été publiée : la
+ * comparaison-échange échoue et "died" reste la seule fin.
  *
- * @dependencies Nécessite l'accès à pthread_mutex_lock,
- * pthread_mutex_unlock et get_time.
+ * @examples signal_all_fed(philo->shared_data);
  *
- * @control_flow 1. Prendre le mutex.
- *               2. Mettre à jour les données.
- *               3. Libérer le mutex.
+ * @dependencies Nécessite l'accès à futex_wake_all et strategy_wake.
+ *
+ * @control_flow 1. Publier ALL_FED, sauf après une mort.
+ *               2. Réveiller les dormeurs.
  */
-void	update_philosopher_data(t_data *data, int *iteration_meal_count,
-	int *time_since_last_meal, int i)
+void	signal_all_fed(t_data *data)
 {
-	pthread_mutex_lock(&data->shared_resource_mutex);
-	*iteration_meal_count += data->philo[i].remaining_meal;
-	*time_since_last_meal = get_time(data->t0)
-		- data->philo[i].last_meal;
-	pthread_mutex_unlock(&data->shared_resource_mutex);
+	int	expected;
+
+	expected = NO_ONE_DIED;
+	if (!atomic_compare_exchange_strong_explicit(&data->someone_died,
+			&expected, ALL_FED, memory_order_release, memory_order_relaxed))
+		return ;
+	data->stop_at = table_now(data);
+	futex_wake_all(&data->someone_died);
+	strategy_wake(data);
 }
 
 /**
- * @function check_philosopher_life
- * @brief Vérifie l'état de vie des philosophes.
+ * @function refresh_deadline
+ * @brief Réévalue le philosophe dont l'échéance est au sommet du tas.
  *
  * @param data: Pointeur vers la structure t_data.
+ * @param heap: Tas d'échéances du moniteur.
+ * @param now: Temps actuel depuis t0, en microsecondes.
+ *
+ * @description Relit last_meal et remaining_meal du philosophe au
+ * sommet. S'il a fini ses repas, il sort du tas ; s'il a mangé depuis,
+ * son échéance est repoussée ; sinon il est mort.
+ *
+ * @return int: SOMEONE_DIED si le philosophe est mort, sinon
+ * NO_ONE_DIED.
+ *
+ * @errors/edge_effects Lectures atomiques en acquire, sans verrou :
+ * le moniteur n'attend jamais derrière les philosophes.
+ *
+ * @examples if (refresh_deadline(data_ptr, heap, get_time(data->t0)))
+ *
+ * @dependencies Nécessite l'accès à atomic_load_explicit,
+ * deadline_heap_pop et deadline_heap_sift_down.
+ *
+ * @control_flow 1. Retirer le philosophe s'il a fini ses repas.
+ *               2. Recalculer son échéance.
+ *               3. Signaler la mort ou repousser l'échéance.
+ */
+int	refresh_deadline(t_data *data, t_deadline_heap *heap, long now)
+{
+	t_deadline	*top;
+	t_philo		*philo;
+
+	top = &heap->nodes[0];
+	philo = &data->philo[top->index];
+	if (!atomic_load_explicit(&philo->remaining_meal, memory_order_acquire))
+	{
+		deadline_heap_pop(heap);
+		return (NO_ONE_DIED);
+	}
+	top->deadline = atomic_load_explicit(&philo->last_meal,
+			memory_order_acquire) + data->global_rules.t_die;
+	if (now > top->deadline)
+		return (SOMEONE_DIED);
+	deadline_heap_sift_down(heap, 0);
+	return (NO_ONE_DIED);
+}
+
+/**
+ * @function watch_deadlines
+ * @brief Surveille une tranche de philosophes jusqu'à une mort.
+ *
+ * @param shard: Tranche surveillée, son tas d'échéances déjà construit.
  * 
- * @description Parcourt chaque philosophe pour vérifier son
- * état. Si un philosophe doit mourir, la fonction signale
- * et imprime la mort.
+ * @description Dort jusqu'à l'échéance la plus proche du tas. Une
+ * échéance ne peut que reculer (un repas la repousse) : au réveil,
+ * seul le sommet est réévalué. La latence de détection ne dépend donc
+ * pas du nombre de philosophes et le moniteur ne consomme presque pas
+ * de CPU. Avant de dormir, publie l'échéance et la taille du tas pour
+ * --metrics, par de simples écritures relâchées.
  *
  * @return void
  * 
- * @errors/edge_effects Utilise les verrous et peut appeler 
- * signal_and_print_death. 
+ * @errors/edge_effects Un philosophe qui a fini ses repas n'est retiré
+ * qu'à son échéance. Le moniteur rend la main quand le tas est vide ou
+ * quand someone_died est levé, par une mort ou par le dernier repas du
+ * quota : sleep_until attend sur ce mot et se réveille aussitôt.
  * 
- * @examples check_philosopher_life(data_ptr);
+ * @examples watch_deadlines(&data->monitors[0]);
  *
- * @dependencies Dépend de update_philosopher_data et 
+ * @dependencies Dépend de refresh_deadline, sleep_until et
  * signal_and_print_death.
  *
- * @control_flow 1. Initialiser les variables.
- *               2. Boucle infinie pour vérifier chaque philosophe.
- *               3. Appeler update_philosopher_data.
- *               4. Vérifier les conditions et agir en conséquence.
+ * @control_flow 1. Publier puis dormir jusqu'à l'échéance du sommet.
+ *               2. Réévaluer le sommet et signaler une mort.
  */
-void	check_philosopher_life(t_data *data)
+void	watch_deadlines(t_monitor *shard)
 {
-	int	i;
-	int	time_since_last_meal;
-	int	iteration_meal_count;
+	t_deadline_heap	*heap;
+	long			now;
 
-	i = INIT_INDEX;
-	iteration_meal_count = INIT_MEALS_EATEN;
-	while (INFINITY_LOOP)
+	heap = &shard->heap;
+	while (heap->size && !atomic_load_explicit(&shard->data->someone_died,
+			memory_order_acquire))
 	{
-		update_philosopher_data(data, &iteration_meal_count,
-			&time_since_last_meal, i);
-		if (time_since_last_meal > data->global_rules.t_die
-			&& data->philo[i].remaining_meal)
+		now = get_time(shard->data->t0);
+		if (now <= heap->nodes[0].deadline)
 		{
-			signal_and_print_death(data, i + PHILO_ID_OFFSET);
-			return ;
+			atomic_store_explicit(&shard->next_deadline,
+				heap->nodes[0].deadline, memory_order_relaxed);
+			atomic_store_explicit(&shard->watched, heap->size,
+				memory_order_relaxed);
+			sleep_until(shard->data, shard->data->t0
+				+ heap->nodes[0].deadline + DEADLINE_GRACE_US);
+			continue ;
 		}
-		if (i == data->global_rules.n_philo - 1
-			&& !iteration_meal_count)
-			return ;
-		else if (i == data->global_rules.n_philo - 1
-			&& iteration_meal_count)
-			iteration_meal_count = INIT_MEALS_EATEN;
-		i++;
-		i = i % data->global_rules.n_philo;
+		if (refresh_deadline(shard->data, heap, now))
+			signal_and_print_death(shard->data,
+				heap->nodes[0].index + PHILO_ID_OFFSET,
+				heap->nodes[0].deadline);
 	}
+	atomic_store_explicit(&shard->watched, heap->size, memory_order_relaxed);
+}
+
+/**
+ * @function print_stop_stats
+ * @brief Affiche le délai entre l'arrêt et le dernier thread rejoint.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description stop_at est l'horodatage de la ligne "died", ou de la
+ * publication de ALL_FED ; t_end est pris après la dernière jointure.
+ * L'écart mesure le temps que met le jeton d'arrêt à faire sortir tous
+ * les threads de leurs attentes.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Rien n'est affiché si la table ne s'est pas
+ * arrêtée par le jeton.
+ *
+ * @examples print_stop_stats(data);
+ *
+ * @dependencies Dépend de fprintf.
+ *
+ * @control_flow 1. Choisir la cause de l'arrêt.
+ *               2. Afficher l'écart.
+ */
+void	print_stop_stats(t_data *data)
+{
+	int		stop;
+	char	*cause;
+
+	stop = atomic_load_explicit(&data->someone_died, memory_order_acquire);
+	if (stop == NO_ONE_DIED)
+		return ;
+	cause = STATS_STOP_DIED;
+	if (stop == ALL_FED)
+		cause = STATS_STOP_FED;
+	fprintf(stderr, STATS_STOP, cause, data->stop_at,
+		data->t_end - data->stop_at);
 }
@@ -18,8 +18,10 @@
  *
  * @param data: Pointeur vers la structure t_data.
  *
- * @description Libère la mémoire allouée pour les fourchettes,
- * les IDs des threads, et les philosophes.
+ * @description Fourchettes, philosophes, identifiants de thread,
+ * anneau du journal et tas d'échéances vivent dans l'arène et partent
+ * avec arena_unmap. Restent les PID des processus ouvriers et la liste
+ * des CPU, dimensionnés après coup.
  *
  * @return void
  * 
@@ -28,19 +30,17 @@
  *
  * @examples free_forks_p_philo(data_ptr);
  *
- * @dependencies Dépend des fonctions free standard.
+ * @dependencies Dépend de free.
  *
  * @control_flow 1. Vérifier chaque ressource.
  *               2. Libérer la mémoire si nécessaire.
  */
 void	free_forks_p_philo(t_data *data)
 {
-	if (data->forks)
-		free(data->forks);
-	if (data->thread_ids)
-		free(data->thread_ids);
-	if (data->philo)
-		free(data->philo);
+	if (data->workers)
+		free(data->workers);
+	if (data->affinity.cpus)
+		free(data->affinity.cpus);
 }
 
 /**
@@ -49,8 +49,9 @@ void	free_forks_p_philo(t_data *data)
  *
  * @param data: Pointeur vers la structure t_data.
  *
- * @description Détruit les mutex pour les fourchettes et les
- * ressources partagées, puis libère la mémoire allouée.
+ * @description Détruit les verrous des fourchettes, le mutex
+ * d'écriture et le journal, libère la mémoire allouée puis retire
+ * l'arène de la table.
  *
  * @return int: Retourne SUCCESS en cas de succès, FAILURE sinon.
  *
@@ -59,28 +60,33 @@ void	free_forks_p_philo(t_data *data)
  *
  * @examples int result = cleanup_and_end(data_ptr);
  *
- * @dependencies Dépend de pthread_mutex_destroy et de
- * free_forks_p_philo.
+ * @dependencies Dépend de pthread_mutex_destroy, log_destroy, de
+ * data->locks, de free_forks_p_philo et de arena_unmap.
  *
- * @control_flow 1. Détruire les mutex des fourchettes.
- *               2. Détruire les autres mutex.
- *               3. Appeler free_forks_p_philo.
+ * @control_flow 1. Détruire les verrous des fourchettes.
+ *               2. Détruire le mutex d'écriture et le journal.
+ *               3. Appeler free_forks_p_philo puis arena_unmap.
  */
 int	cleanup_and_end(t_data *data)
 {
 	int	i;
 
 	i = 0;
-	while (i < data->global_rules.n_philo)
+	while (data->locks->destroy && i < data->global_rules.n_philo)
 	{
-		if (pthread_mutex_destroy(&data->forks[i]))
+		if (data->locks->destroy(&data->forks[i].lock))
 			return (FAILURE);
 		i++;
 	}
-	if (pthread_mutex_destroy(&data->shared_resource_mutex))
-		return (FAILURE);
 	if (pthread_mutex_destroy(&data->write))
 		return (FAILURE);
+	if (log_destroy(&data->log))
+		return (FAILURE);
+	if (data->opts.strategy == STRATEGY_WAITER && waiter_destroy(data))
+		return (FAILURE);
+	if (data->opts.mode != MODE_THREADS)
+		destroy_task_scheduler(data);
 	free_forks_p_philo(data);
+	arena_unmap(data);
 	return (SUCCESS);
 }
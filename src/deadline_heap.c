@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_heap.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:21:33 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 12:21:33 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function deadline_heap_sift_down
+ * @brief Rétablit l'ordre du tas à partir d'un nœud.
+ *
+ * @param heap: Pointeur vers le tas d'échéances.
+ * @param i: Index du nœud dont l'échéance a augmenté.
+ *
+ * @description Fait descendre le nœud tant qu'un de ses fils a une
+ * échéance plus proche. Les échéances ne font qu'augmenter (un repas
+ * repousse la mort), donc la descente suffit.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples deadline_heap_sift_down(&data->deadlines, 0);
+ *
+ * @dependencies Aucune dépendance externe.
+ *
+ * @control_flow 1. Choisir le fils à l'échéance la plus proche.
+ *               2. Échanger si nécessaire.
+ *               3. Recommencer depuis le fils.
+ */
+void	deadline_heap_sift_down(t_deadline_heap *heap, int i)
+{
+	int			child;
+	t_deadline	node;
+
+	node = heap->nodes[i];
+	child = 2 * i + 1;
+	while (child < heap->size)
+	{
+		if (child + 1 < heap->size
+			&& heap->nodes[child + 1].deadline < heap->nodes[child].deadline)
+			child++;
+		if (node.deadline <= heap->nodes[child].deadline)
+			break ;
+		heap->nodes[i] = heap->nodes[child];
+		i = child;
+		child = 2 * i + 1;
+	}
+	heap->nodes[i] = node;
+}
+
+/**
+ * @function deadline_heap_build
+ * @brief Construit le tas des échéances de mort initiales.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param heap: Tas du moniteur, dont size est déjà le nombre de nœuds.
+ * @param first: Index du premier philosophe de la tranche surveillée.
+ *
+ * @description Chaque philosophe de [first, first + size) reçoit
+ * l'échéance last_meal + t_die. Le tas est privé à son moniteur : les
+ * philosophes ne le touchent pas et publient seulement leur last_meal
+ * atomique.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples deadline_heap_build(data_ptr, &shard->heap, 250);
+ *
+ * @dependencies Dépend de deadline_heap_sift_down.
+ *
+ * @control_flow 1. Remplir les nœuds.
+ *               2. Tamiser depuis le dernier parent.
+ */
+void	deadline_heap_build(t_data *data, t_deadline_heap *heap, int first)
+{
+	int	i;
+
+	i = 0;
+	while (i < heap->size)
+	{
+		heap->nodes[i].index = first + i;
+		heap->nodes[i].deadline = atomic_load_explicit(
+				&data->philo[first + i].last_meal, memory_order_acquire)
+			+ data->global_rules.t_die;
+		i++;
+	}
+	i = heap->size / 2;
+	while (i-- > 0)
+		deadline_heap_sift_down(heap, i);
+}
+
+/**
+ * @function deadline_heap_pop
+ * @brief Retire l'échéance la plus proche du tas.
+ *
+ * @param heap: Pointeur vers le tas d'échéances.
+ *
+ * @description Utilisé quand le philosophe au sommet a fini ses repas :
+ * il ne peut plus mourir et ne doit plus être surveillé.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Sans effet sur un tas vide.
+ *
+ * @examples deadline_heap_pop(&data->deadlines);
+ *
+ * @dependencies Dépend de deadline_heap_sift_down.
+ *
+ * @control_flow 1. Remplacer le sommet par le dernier nœud.
+ *               2. Tamiser depuis le sommet.
+ */
+void	deadline_heap_pop(t_deadline_heap *heap)
+{
+	if (!heap->size)
+		return ;
+	heap->size--;
+	if (!heap->size)
+		return ;
+	heap->nodes[0] = heap->nodes[heap->size];
+	deadline_heap_sift_down(heap, 0);
+}
+
+/**
+ * @function deadline_heap_push
+ * @brief Insère une échéance dans le tas.
+ *
+ * @param heap: Pointeur vers le tas d'échéances.
+ * @param deadline: L'échéance à insérer.
+ * @param index: L'index du philosophe associé.
+ *
+ * @description Sert aux minuteries des ouvriers du mode tâches : une
+ * tâche qui dort est rangée selon son heure de réveil.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Le tas doit avoir été alloué pour n_philo nœuds.
+ *
+ * @examples deadline_heap_push(&worker->timers, wake_at, 3);
+ *
+ * @dependencies Aucune dépendance externe.
+ *
+ * @control_flow 1. Placer le nœud en fin de tas.
+ *               2. Le faire remonter tant que son parent est plus tardif.
+ */
+void	deadline_heap_push(t_deadline_heap *heap, long deadline, int index)
+{
+	int	i;
+	int	parent;
+
+	i = heap->size++;
+	while (i > 0)
+	{
+		parent = (i - 1) / 2;
+		if (heap->nodes[parent].deadline <= deadline)
+			break ;
+		heap->nodes[i] = heap->nodes[parent];
+		i = parent;
+	}
+	heap->nodes[i].deadline = deadline;
+	heap->nodes[i].index = index;
+}
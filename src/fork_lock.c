@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:32:10 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 18:32:10 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        get_fork_lock
+ * @brief           Donne l'implémentation des verrous de fourchette.
+ * @param int       id - LOCK_*.
+ * 
+ * @description     Table des verrous : nom pour --lock, taille du verrou
+ *                  et opérations. destroy vaut NULL quand il n'y a rien à
+ *                  libérer.
+ * 
+ * @return          Pointeur vers les opérations.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         data->locks = get_fork_lock(data->opts.lock);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Indexation de la table.
+ */
+t_lock_ops	*get_fork_lock(int id)
+{
+	static t_lock_ops	locks[LOCK_COUNT] = {
+	{"pthread", sizeof(pthread_mutex_t), &mutex_lock_init,
+		&mutex_lock_acquire, &mutex_lock_release, &mutex_lock_destroy},
+	{"futex", sizeof(atomic_int), &word_lock_init,
+		&futex_lock_acquire, &futex_lock_release, NULL},
+	{"ticket", sizeof(t_ticket_lock), &word_lock_init,
+		&ticket_lock_acquire, &ticket_lock_release, NULL},
+	{"mcs", sizeof(t_mcs_lock), &word_lock_init,
+		&mcs_lock_acquire, &mcs_lock_release, NULL}};
+
+	return (&locks[id]);
+}
+
+/**
+ * @function        parse_fork_lock
+ * @brief           Lit la valeur de --lock=.
+ * @param const     char *name - Nom du verrou.
+ * @param t_options *opts - Reçoit son identifiant.
+ * 
+ * @description     Noms reconnus : pthread, futex, ticket, mcs.
+ * 
+ * @return          SUCCESS ou FAILURE si le nom est inconnu.
+ * 
+ * @side_effect     Modification des options.
+ * 
+ * @example         parse_fork_lock("mcs", opts);
+ * 
+ * @dependencies    get_fork_lock, strcmp
+ * 
+ * @control_flow    1. Recherche du nom dans la table.
+ */
+int	parse_fork_lock(const char *name, t_options *opts)
+{
+	int	i;
+
+	i = 0;
+	while (i < LOCK_COUNT)
+	{
+		if (!strcmp(name, get_fork_lock(i)->name))
+		{
+			opts->lock = i;
+			return (SUCCESS);
+		}
+		i++;
+	}
+	return (FAILURE);
+}
+
+/**
+ * @function        fork_lock
+ * @brief           Verrouille une fourchette.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param t_fork    *fork - La fourchette.
+ * @param atomic_int *stop - Jeton d'arrêt, ou NULL.
+ * 
+ * @description     Point d'entrée unique des stratégies et du mode tâches,
+ *                  quel que soit le verrou choisi avec --lock. Avec un
+ *                  jeton, une attente longue (fourchette tenue pendant un
+ *                  repas) est interrompue par l'arrêt ; les sections
+ *                  courtes passent NULL et prennent toujours le verrou.
+ *                  Dans un binaire make profile, l'attente est mesurée ;
+ *                  sinon PROFILE_ENABLED vaut 0 et seul l'appel reste.
+ * 
+ * @return          SUCCESS, ou FAILURE si l'arrêt a interrompu l'attente :
+ *                  la fourchette n'est alors pas verrouillée.
+ * 
+ * @side_effect     Peut bloquer.
+ * 
+ * @example         fork_lock(data, &data->forks[first_fork], stop);
+ * 
+ * @dependencies    data->locks, profile_now, profile_acquired
+ * 
+ * @control_flow    1. Appel de l'implémentation choisie.
+ *                  2. Avec PHILO_PROFILE, attente et prise comptées.
+ */
+int	fork_lock(t_data *data, t_fork *fork, atomic_int *stop)
+{
+	long	asked_at;
+
+	if (!PROFILE_ENABLED || !data->profiles)
+		return (data->locks->lock(&fork->lock, stop));
+	asked_at = profile_now();
+	if (data->locks->lock(&fork->lock, stop))
+		return (FAILURE);
+	profile_acquired(&data->profiles[fork - data->forks], asked_at);
+	return (SUCCESS);
+}
+
+/**
+ * @function        fork_unlock
+ * @brief           Déverrouille une fourchette.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param t_fork    *fork - La fourchette, verrouillée par l'appelant.
+ * 
+ * @description     Pendant de fork_lock. Avec PHILO_PROFILE, la détention
+ *                  est enregistrée avant de rendre la fourchette.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Peut réveiller un thread en attente.
+ * 
+ * @example         fork_unlock(data, &data->forks[first_fork]);
+ * 
+ * @dependencies    data->locks, profile_released
+ * 
+ * @control_flow    1. Avec PHILO_PROFILE, détention enregistrée.
+ *                  2. Appel de l'implémentation choisie.
+ */
+void	fork_unlock(t_data *data, t_fork *fork)
+{
+	if (PROFILE_ENABLED && data->profiles)
+		profile_released(&data->profiles[fork - data->forks]);
+	data->locks->unlock(&fork->lock);
+}
+
+/**
+ * @function        word_lock_init
+ * @brief           Initialise un verrou futex, ticket ou MCS.
+ * @param t_fork_lock *lock - Le verrou.
+ * @param int       shared - Ignoré.
+ * 
+ * @description     Ces trois verrous sont libres quand tous leurs mots
+ *                  valent zéro. Futex et ticket attendent sur des futex
+ *                  non privés : ils marchent tels quels entre processus.
+ * 
+ * @return          SUCCESS.
+ * 
+ * @side_effect     Mise à zéro du verrou.
+ * 
+ * @example         data->locks->init(&data->forks[i].lock, 0);
+ * 
+ * @dependencies    memset
+ * 
+ * @control_flow    1. Mise à zéro.
+ */
+int	word_lock_init(t_fork_lock *lock, int shared)
+{
+	(void)shared;
+	memset(lock, 0, sizeof(t_fork_lock));
+	return (SUCCESS);
+}
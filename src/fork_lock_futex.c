@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_futex.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:47:36 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 18:47:36 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        futex_wait
+ * @brief           Attend sans échéance un changement du mot futex.
+ * @param atomic_int *word - Le mot surveillé.
+ * @param int       expected - La valeur tant que dure l'attente.
+ * 
+ * @description     Pour les verrous : c'est le déverrouillage qui réveille,
+ *                  une mort n'a pas à interrompre l'attente. Comme
+ *                  futex_wait_until, le futex n'est pas privé.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Bloque le thread dans le noyau.
+ * 
+ * @example         futex_wait(&lock->futex, FUTEX_LOCK_CONTENDED);
+ * 
+ * @dependencies    syscall, SYS_futex
+ * 
+ * @control_flow    1. FUTEX_WAIT tant que le mot vaut 'expected'.
+ */
+void	futex_wait(atomic_int *word, int expected)
+{
+	syscall(SYS_futex, (int *)word, FUTEX_WAIT, expected, NULL, NULL, 0);
+}
+
+/**
+ * @function        futex_wait_stop
+ * @brief           Attend un changement du mot futex ou du jeton d'arrêt.
+ * @param atomic_int *word - Le mot surveillé.
+ * @param int       expected - La valeur tant que dure l'attente.
+ * @param atomic_int *stop - Jeton d'arrêt (someone_died), ou NULL.
+ * 
+ * @description     futex_waitv garde le thread sur deux mots à la fois :
+ *                  le déverrouillage comme le futex_wake_all qui publie
+ *                  l'arrêt le réveillent, sans scruter. Sans jeton, ou si
+ *                  le noyau ne connaît pas futex_waitv (avant 5.16), c'est
+ *                  futex_wait : seul le déverrouillage réveille.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Bloque le thread dans le noyau.
+ * 
+ * @example         futex_wait_stop(&lock->futex, FUTEX_LOCK_CONTENDED, stop);
+ * 
+ * @dependencies    syscall, SYS_futex_waitv, futex_wait
+ * 
+ * @control_flow    1. Attente sur le mot et le jeton, qui vaut NO_ONE_DIED.
+ *                  2. Repli sur futex_wait si futex_waitv manque.
+ */
+void	futex_wait_stop(atomic_int *word, int expected, atomic_int *stop)
+{
+	struct futex_waitv	waiters[2];
+
+	if (!stop)
+	{
+		futex_wait(word, expected);
+		return ;
+	}
+	memset(waiters, 0, sizeof(waiters));
+	waiters[0].val = expected;
+	waiters[0].uaddr = (uintptr_t)word;
+	waiters[0].flags = FUTEX_32;
+	waiters[1].val = NO_ONE_DIED;
+	waiters[1].uaddr = (uintptr_t)stop;
+	waiters[1].flags = FUTEX_32;
+	if (syscall(SYS_futex_waitv, waiters, 2, 0, NULL, 0) < 0
+		&& errno == ENOSYS)
+		futex_wait(word, expected);
+}
+
+/**
+ * @function        futex_wake_one
+ * @brief           Réveille un seul thread en attente sur un mot futex.
+ * @param atomic_int *word - Le mot dont la valeur vient de changer.
+ * 
+ * @description     Un verrou libéré ne sert qu'un attendant : en réveiller
+ *                  plus ferait se battre des threads pour rien.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Réveil d'un thread en attente.
+ * 
+ * @example         futex_wake_one(&lock->futex);
+ * 
+ * @dependencies    syscall, SYS_futex
+ * 
+ * @control_flow    1. FUTEX_WAKE sur un attendant.
+ */
+void	futex_wake_one(atomic_int *word)
+{
+	syscall(SYS_futex, (int *)word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+/**
+ * @function        futex_lock_acquire
+ * @brief           Verrouille un verrou futex (--lock=futex).
+ * @param t_fork_lock *lock - Le verrou.
+ * @param atomic_int *stop - Jeton d'arrêt, ou NULL pour attendre le verrou.
+ * 
+ * @description     Un seul mot de 4 octets : libre, pris, ou pris avec des
+ *                  attendants. Quelques essais en espace utilisateur, puis
+ *                  le mot passe à FUTEX_LOCK_CONTENDED et le thread se gare
+ *                  dans le noyau. Pas d'appel système sans contention.
+ *                  Garé, il se réveille aussi sur le jeton d'arrêt et
+ *                  renonce au verrou.
+ * 
+ * @return          SUCCESS, ou FAILURE si l'arrêt est publié avant que le
+ *                  verrou soit pris.
+ * 
+ * @side_effect     Peut bloquer. Un abandon laisse le mot à
+ *                  FUTEX_LOCK_CONTENDED : le déverrouillage suivant fera un
+ *                  réveil de trop, sans autre effet.
+ * 
+ * @example         if (fork_lock(data, fork, &data->someone_died))
+ * 
+ * @dependencies    futex_wait_stop
+ * 
+ * @control_flow    1. LOCK_SPIN essais de prise d'un verrou libre.
+ *                  2. Sinon marquer la contention et attendre, sauf arrêt.
+ */
+int	futex_lock_acquire(t_fork_lock *lock, atomic_int *stop)
+{
+	int	spin;
+	int	free_word;
+
+	spin = 0;
+	while (spin++ < LOCK_SPIN)
+	{
+		free_word = FUTEX_LOCK_FREE;
+		if (atomic_load_explicit(&lock->futex, memory_order_relaxed)
+			== FUTEX_LOCK_FREE
+			&& atomic_compare_exchange_weak_explicit(&lock->futex,
+				&free_word, FUTEX_LOCK_TAKEN, memory_order_acquire,
+				memory_order_relaxed))
+			return (SUCCESS);
+	}
+	while (atomic_exchange_explicit(&lock->futex, FUTEX_LOCK_CONTENDED,
+			memory_order_acquire) != FUTEX_LOCK_FREE)
+	{
+		if (stop && atomic_load_explicit(stop, memory_order_acquire))
+			return (FAILURE);
+		futex_wait_stop(&lock->futex, FUTEX_LOCK_CONTENDED, stop);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        futex_lock_release
+ * @brief           Déverrouille un verrou futex.
+ * @param t_fork_lock *lock - Le verrou.
+ * 
+ * @description     L'appel système n'a lieu que si un attendant s'est
+ *                  signalé.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Peut réveiller un thread en attente.
+ * 
+ * @example         fork_unlock(data, fork);
+ * 
+ * @dependencies    futex_wake_one
+ * 
+ * @control_flow    1. Libération du mot.
+ *                  2. Réveil d'un attendant si contention.
+ */
+void	futex_lock_release(t_fork_lock *lock)
+{
+	if (atomic_exchange_explicit(&lock->futex, FUTEX_LOCK_FREE,
+			memory_order_release) == FUTEX_LOCK_CONTENDED)
+		futex_wake_one(&lock->futex);
+}
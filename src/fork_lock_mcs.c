@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_mcs.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:58:21 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 18:58:21 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        mcs_node_get
+ * @brief           Donne un nœud MCS libre du thread courant.
+ * 
+ * @description     Un thread tient au plus MCS_MAX_HELD fourchettes à la
+ *                  fois, chacune avec son nœud. Les nœuds sont locaux au
+ *                  thread : l'interface fork_lock n'a pas à les transporter.
+ * 
+ * @return          Pointeur vers un nœud libre.
+ * 
+ * @side_effect     Le nœud est marqué utilisé jusqu'au déverrouillage.
+ * 
+ * @example         node = mcs_node_get();
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Premier nœud libre.
+ */
+t_mcs_node	*mcs_node_get(void)
+{
+	static _Thread_local t_mcs_node	nodes[MCS_MAX_HELD];
+	int								i;
+
+	i = 0;
+	while (nodes[i].in_use)
+		i++;
+	nodes[i].in_use = 1;
+	return (&nodes[i]);
+}
+
+/**
+ * @function        mcs_lock_acquire
+ * @brief           Verrouille un verrou MCS (--lock=mcs).
+ * @param t_fork_lock *lock - Le verrou.
+ * @param atomic_int *stop - Ignoré.
+ * 
+ * @description     File d'attente chaînée : chaque demandeur s'ajoute en
+ *                  queue et attend sur son propre nœud, pas sur le verrou.
+ *                  Ordre d'arrivée, et un seul thread réveillé par
+ *                  libération. Après LOCK_SPIN lectures le nœud passe à
+ *                  MCS_PARKED et le thread se gare dessus. Un nœud en file
+ *                  ne peut pas être abandonné : le prédécesseur écrira
+ *                  dedans en rendant le verrou. L'arrêt n'interrompt donc
+ *                  pas l'attente ; les détenteurs, réveillés par l'arrêt,
+ *                  vident la file.
+ * 
+ * @return          SUCCESS.
+ * 
+ * @side_effect     Peut bloquer.
+ * 
+ * @example         fork_lock(data, fork, NULL);
+ * 
+ * @dependencies    mcs_node_get, futex_wait
+ * 
+ * @control_flow    1. Ajout du nœud en queue.
+ *                  2. S'il y avait un prédécesseur, attendre son signal.
+ *                  3. Noter le nœud détenteur.
+ */
+int	mcs_lock_acquire(t_fork_lock *lock, atomic_int *stop)
+{
+	t_mcs_node	*node;
+	t_mcs_node	*prev;
+	int			spin;
+	int			waiting;
+
+	(void)stop;
+	node = mcs_node_get();
+	atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+	atomic_store_explicit(&node->locked, MCS_WAITING, memory_order_relaxed);
+	prev = atomic_exchange_explicit(&lock->mcs.tail, node,
+			memory_order_acq_rel);
+	spin = 0;
+	if (prev)
+		atomic_store_explicit(&prev->next, node, memory_order_release);
+	while (prev && atomic_load_explicit(&node->locked, memory_order_acquire))
+	{
+		waiting = MCS_WAITING;
+		if (++spin > LOCK_SPIN && (atomic_compare_exchange_strong(
+					&node->locked, &waiting, MCS_PARKED)
+				|| waiting == MCS_PARKED))
+			futex_wait(&node->locked, MCS_PARKED);
+	}
+	lock->mcs.holder = node;
+	return (SUCCESS);
+}
+
+/**
+ * @function        mcs_lock_release
+ * @brief           Déverrouille un verrou MCS.
+ * @param t_fork_lock *lock - Le verrou.
+ * 
+ * @description     Sans successeur, la queue est remise à NULL. Un
+ *                  successeur qui vient d'échanger la queue mais n'a pas
+ *                  encore chaîné son nœud est attendu en cédant le CPU.
+ *                  L'appel système n'a lieu que s'il s'est garé.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Peut réveiller le successeur.
+ * 
+ * @example         fork_unlock(data, fork);
+ * 
+ * @dependencies    futex_wake_one, sched_yield
+ * 
+ * @control_flow    1. Sans successeur : libérer la queue.
+ *                  2. Sinon attendre son chaînage et lui passer la main.
+ */
+void	mcs_lock_release(t_fork_lock *lock)
+{
+	t_mcs_node	*node;
+	t_mcs_node	*next;
+	t_mcs_node	*expected;
+
+	node = lock->mcs.holder;
+	next = atomic_load_explicit(&node->next, memory_order_acquire);
+	expected = node;
+	if (!next && atomic_compare_exchange_strong_explicit(&lock->mcs.tail,
+			&expected, NULL, memory_order_release, memory_order_relaxed))
+	{
+		node->in_use = 0;
+		return ;
+	}
+	while (!next)
+	{
+		sched_yield();
+		next = atomic_load_explicit(&node->next, memory_order_acquire);
+	}
+	node->in_use = 0;
+	if (atomic_exchange_explicit(&next->locked, 0, memory_order_release)
+		== MCS_PARKED)
+		futex_wake_one(&next->locked);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_mutex.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:32:10 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 18:32:10 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        mutex_lock_init
+ * @brief           Initialise un verrou pthread (--lock=pthread).
+ * @param t_fork_lock *lock - Le verrou.
+ * @param int       shared - Partagé entre processus si non nul.
+ * 
+ * @description     Verrou par défaut : pthread_mutex_t sans attribut,
+ *                  sauf PTHREAD_PROCESS_SHARED avec --processes.
+ *                  40 octets, appel système en cas de contention, aucune
+ *                  équité.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @side_effect     Initialisation du mutex.
+ * 
+ * @example         data->locks->init(&data->forks[i].lock);
+ * 
+ * @dependencies    shared_mutex_init
+ * 
+ * @control_flow    1. Initialisation.
+ */
+int	mutex_lock_init(t_fork_lock *lock, int shared)
+{
+	return (shared_mutex_init(&lock->mutex, shared));
+}
+
+/**
+ * @function        mutex_lock_acquire
+ * @brief           Verrouille un verrou pthread.
+ * @param t_fork_lock *lock - Le verrou.
+ * @param atomic_int *stop - Ignoré.
+ * 
+ * @description     Appel de shared_mutex_lock. Un pthread_mutex_t ne peut
+ *                  pas attendre un second mot : ses attendants sont libérés
+ *                  par le détenteur, qui sort de son sommeil dès l'arrêt
+ *                  et rend ses fourchettes.
+ * 
+ * @return          SUCCESS.
+ * 
+ * @side_effect     Peut bloquer.
+ * 
+ * @example         fork_lock(data, fork, &data->someone_died);
+ * 
+ * @dependencies    shared_mutex_lock
+ * 
+ * @control_flow    1. Verrouillage.
+ */
+int	mutex_lock_acquire(t_fork_lock *lock, atomic_int *stop)
+{
+	(void)stop;
+	shared_mutex_lock(&lock->mutex);
+	return (SUCCESS);
+}
+
+/**
+ * @function        mutex_lock_release
+ * @brief           Déverrouille un verrou pthread.
+ * @param t_fork_lock *lock - Le verrou.
+ * 
+ * @description     Appel direct de pthread_mutex_unlock.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Peut réveiller un thread en attente.
+ * 
+ * @example         fork_unlock(data, fork);
+ * 
+ * @dependencies    pthread_mutex_unlock
+ * 
+ * @control_flow    1. Déverrouillage.
+ */
+void	mutex_lock_release(t_fork_lock *lock)
+{
+	pthread_mutex_unlock(&lock->mutex);
+}
+
+/**
+ * @function        mutex_lock_destroy
+ * @brief           Détruit un verrou pthread.
+ * @param t_fork_lock *lock - Le verrou, libre.
+ * 
+ * @description     Appelée par cleanup_and_end.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @side_effect     Destruction du mutex.
+ * 
+ * @example         data->locks->destroy(&data->forks[i].lock);
+ * 
+ * @dependencies    pthread_mutex_destroy
+ * 
+ * @control_flow    1. Destruction.
+ */
+int	mutex_lock_destroy(t_fork_lock *lock)
+{
+	if (pthread_mutex_destroy(&lock->mutex))
+		return (FAILURE);
+	return (SUCCESS);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_ticket.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:47:36 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 18:47:36 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        ticket_lock_wait
+ * @brief           Attend que 'serving' atteigne un ticket déjà tiré.
+ * @param t_fork_lock *lock - Le verrou.
+ * @param int       ticket - Le ticket tiré par ticket_lock_acquire.
+ * @param atomic_int *stop - Jeton d'arrêt, ou NULL pour attendre son tour.
+ * 
+ * @description     Après LOCK_SPIN lectures le thread se déclare dans
+ *                  'waiting' et se gare sur 'serving'. Les accès à
+ *                  'waiting' et 'serving' sont séquentiellement
+ *                  cohérents : soit le déverrouillage voit l'attendant,
+ *                  soit l'attendant voit le nouveau 'serving'. Garé, le
+ *                  thread se réveille aussi sur le jeton d'arrêt.
+ * 
+ * @return          SUCCESS à son tour, ou FAILURE si l'arrêt est publié
+ *                  avant.
+ * 
+ * @side_effect     Peut bloquer.
+ * 
+ * @example         if (!ticket_lock_wait(lock, ticket, stop))
+ * 
+ * @dependencies    futex_wait_stop
+ * 
+ * @control_flow    1. Attente active puis garée jusqu'à son tour, sauf
+ *                     arrêt.
+ */
+int	ticket_lock_wait(t_fork_lock *lock, int ticket, atomic_int *stop)
+{
+	int	serving;
+	int	spin;
+
+	serving = atomic_load_explicit(&lock->ticket.serving,
+			memory_order_acquire);
+	spin = 0;
+	while (serving != ticket)
+	{
+		if (++spin > LOCK_SPIN)
+		{
+			if (stop && atomic_load_explicit(stop, memory_order_acquire))
+				return (FAILURE);
+			atomic_fetch_add(&lock->ticket.waiting, 1);
+			serving = atomic_load(&lock->ticket.serving);
+			if (serving != ticket)
+				futex_wait_stop(&lock->ticket.serving, serving, stop);
+			atomic_fetch_sub(&lock->ticket.waiting, 1);
+		}
+		serving = atomic_load_explicit(&lock->ticket.serving,
+				memory_order_acquire);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        ticket_lock_acquire
+ * @brief           Verrouille un verrou à tickets (--lock=ticket).
+ * @param t_fork_lock *lock - Le verrou.
+ * @param atomic_int *stop - Jeton d'arrêt, ou NULL pour attendre son tour.
+ * 
+ * @description     Chaque demandeur tire un ticket et attend que 'serving'
+ *                  l'atteigne : les deux voisins d'une fourchette sont
+ *                  servis dans l'ordre d'arrivée. Un ticket tiré ne peut
+ *                  pas être sauté : 'serving' s'arrêterait dessus et
+ *                  bloquerait tous les suivants, y compris ceux qui
+ *                  attendent sans jeton d'arrêt. Sur arrêt, le thread
+ *                  attend donc quand même son tour, puis le rend aussitôt.
+ *                  Les détenteurs qui le précèdent sortent de leur repas
+ *                  sur l'arrêt : cette attente est courte.
+ * 
+ * @return          SUCCESS, ou FAILURE si l'arrêt est publié avant son tour.
+ * 
+ * @side_effect     Peut bloquer.
+ * 
+ * @example         if (fork_lock(data, fork, &data->someone_died))
+ * 
+ * @dependencies    ticket_lock_wait, ticket_lock_release
+ * 
+ * @control_flow    1. Tirage du ticket.
+ *                  2. Attente de son tour, sauf arrêt.
+ *                  3. Sur arrêt, attendre son tour puis le rendre.
+ */
+int	ticket_lock_acquire(t_fork_lock *lock, atomic_int *stop)
+{
+	int	ticket;
+
+	ticket = atomic_fetch_add_explicit(&lock->ticket.next, 1,
+			memory_order_relaxed);
+	if (!ticket_lock_wait(lock, ticket, stop))
+		return (SUCCESS);
+	ticket_lock_wait(lock, ticket, NULL);
+	ticket_lock_release(lock);
+	return (FAILURE);
+}
+
+/**
+ * @function        ticket_lock_release
+ * @brief           Déverrouille un verrou à tickets.
+ * @param t_fork_lock *lock - Le verrou.
+ * 
+ * @description     Passe au ticket suivant. Les attendants garés sont tous
+ *                  réveillés, seul celui dont c'est le tour continue.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Peut réveiller des threads en attente.
+ * 
+ * @example         fork_unlock(data, fork);
+ * 
+ * @dependencies    futex_wake_all
+ * 
+ * @control_flow    1. Ticket suivant.
+ *                  2. Réveil si quelqu'un est garé.
+ */
+void	ticket_lock_release(t_fork_lock *lock)
+{
+	atomic_fetch_add(&lock->ticket.serving, 1);
+	if (atomic_load(&lock->ticket.waiting))
+		futex_wake_all(&lock->ticket.serving);
+}
@@ -99,3 +99,47 @@ long	ft_atol(const char *nptr)
 	}
 	return (convert_to_long(nptr, i, sign));
 }
+
+/**
+ * @function ft_atous
+ * @brief Convertit une durée en millisecondes en microsecondes.
+ *
+ * @param nptr: La chaîne à convertir, par exemple "200" ou "200.25".
+ *
+ * @description La partie entière est lue comme des millisecondes ; une
+ * partie décimale optionnelle d'au plus MAX_FRACTION_DIGITS chiffres
+ * donne la précision sous la milliseconde.
+ *
+ * @return long: Retourne la durée en microsecondes.
+ *
+ * @errors/edge_effects La validité du format est vérifiée en amont par
+ * check_arg ; les chiffres décimaux en trop sont ignorés.
+ *
+ * @examples long us = ft_atous("0.5");
+ *
+ * @dependencies Dépend de ft_atol.
+ *
+ * @control_flow 1. Convertir la partie entière.
+ *               2. Ajouter la partie décimale.
+ *               3. Compléter jusqu'aux microsecondes.
+ */
+long	ft_atous(const char *nptr)
+{
+	long	us;
+	long	scale;
+	int		i;
+
+	us = ft_atol(nptr) * US_TO_MS;
+	i = 0;
+	while (nptr[i] && nptr[i] != '.')
+		i++;
+	if (!nptr[i])
+		return (us);
+	scale = US_TO_MS / 10;
+	while (nptr[++i] >= '0' && nptr[i] <= '9' && scale)
+	{
+		us += (nptr[i] - '0') * scale;
+		scale /= 10;
+	}
+	return (us);
+}
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   histo.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:48:03 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 16:48:03 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        histo_index
+ * @brief           Donne le seau d'une valeur.
+ * @param long      value - La valeur en microsecondes.
+ * 
+ * @description     Seaux logarithmiques : chaque puissance de deux est
+ *                  coupée en HISTO_SUB_BUCKETS seaux linéaires, soit une
+ *                  erreur relative d'au plus 12,5 %. Les valeurs sous
+ *                  HISTO_SUB_BUCKETS ont chacune leur seau.
+ * 
+ * @return          L'index du seau.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         histo_index(1500) == 67
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Valeurs exactes sous HISTO_SUB_BUCKETS.
+ *                  2. Bit de poids fort, puis bits suivants.
+ */
+int	histo_index(long value)
+{
+	int	msb;
+
+	if (value < HISTO_SUB_BUCKETS)
+		return (value);
+	msb = HISTO_SUB_BITS;
+	while (value >> (msb + 1))
+		msb++;
+	return ((msb - HISTO_SUB_BITS + 1) * HISTO_SUB_BUCKETS
+		+ ((value >> (msb - HISTO_SUB_BITS)) & (HISTO_SUB_BUCKETS - 1)));
+}
+
+/**
+ * @function        histo_floor
+ * @brief           Plus petite valeur d'un seau.
+ * @param int       index - L'index du seau.
+ * 
+ * @description     Inverse de histo_index.
+ * 
+ * @return          La borne basse du seau.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         histo_floor(histo_index(v)) <= v
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Seaux exacts.
+ *                  2. Reconstruction de la mantisse et du décalage.
+ */
+long	histo_floor(int index)
+{
+	long	mantissa;
+
+	if (index < HISTO_SUB_BUCKETS)
+		return (index);
+	mantissa = HISTO_SUB_BUCKETS + index % HISTO_SUB_BUCKETS;
+	return (mantissa << (index / HISTO_SUB_BUCKETS - 1));
+}
+
+/**
+ * @function        histo_record
+ * @brief           Ajoute une mesure à un histogramme.
+ * @param t_histo   *histo - L'histogramme.
+ * @param long      value - La mesure en microsecondes.
+ * 
+ * @description     Sans verrou : plusieurs threads peuvent enregistrer en
+ *                  même temps. Les valeurs négatives comptent pour 0.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Mise à jour atomique des compteurs.
+ * 
+ * @example         histo_record(&data->histos.sleep, overshoot);
+ * 
+ * @dependencies    histo_index
+ * 
+ * @control_flow    1. Incrément du seau et du total.
+ *                  2. Mise à jour du maximum.
+ */
+void	histo_record(t_histo *histo, long value)
+{
+	long	max;
+
+	if (value < 0)
+		value = 0;
+	atomic_fetch_add_explicit(&histo->buckets[histo_index(value)], 1,
+		memory_order_relaxed);
+	atomic_fetch_add_explicit(&histo->count, 1, memory_order_relaxed);
+	max = atomic_load_explicit(&histo->max, memory_order_relaxed);
+	while (value > max)
+	{
+		if (atomic_compare_exchange_weak_explicit(&histo->max, &max, value,
+				memory_order_relaxed, memory_order_relaxed))
+			break ;
+	}
+}
+
+/**
+ * @function        histo_percentile
+ * @brief           Calcule un percentile d'un histogramme.
+ * @param t_histo   *histo - L'histogramme, lu après les threads.
+ * @param int       permille - Le rang voulu, en pour mille.
+ * 
+ * @description     Rend la borne haute du seau atteint, bornée par le
+ *                  maximum : le percentile réel ne la dépasse jamais. Un
+ *                  histogramme vide donne 0.
+ * 
+ * @return          Le percentile en microsecondes.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         p99 = histo_percentile(histo, HISTO_P99);
+ * 
+ * @dependencies    histo_floor
+ * 
+ * @control_flow    1. Rang visé.
+ *                  2. Cumul des seaux jusqu'à ce rang.
+ */
+long	histo_percentile(t_histo *histo, int permille)
+{
+	unsigned long	rank;
+	unsigned long	seen;
+	int				i;
+
+	if (!histo->count)
+		return (0);
+	rank = (histo->count * permille + HISTO_PERMILLE - 1) / HISTO_PERMILLE;
+	seen = 0;
+	i = 0;
+	while (i < HISTO_BUCKETS - 1)
+	{
+		seen += histo->buckets[i];
+		if (seen >= rank)
+			break ;
+		i++;
+	}
+	if (histo_floor(i + 1) - 1 < histo->max)
+		return (histo_floor(i + 1) - 1);
+	return (histo->max);
+}
+
+/**
+ * @function        print_histo
+ * @brief           Affiche p50, p99 et le maximum d'un histogramme.
+ * @param const     char *name - Le nom de la mesure.
+ * @param t_histo   *histo - L'histogramme.
+ * 
+ * @description     Une ligne sur stderr, même vide, pour que chaque run
+ *                  donne les mêmes lignes.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Impression sur stderr.
+ * 
+ * @example         print_histo(HISTO_DEATH, &data->histos.death);
+ * 
+ * @dependencies    histo_percentile
+ * 
+ * @control_flow    1. Impression de la ligne.
+ */
+void	print_histo(const char *name, t_histo *histo)
+{
+	fprintf(stderr, HISTO_FORMAT, name, histo->count,
+		histo_percentile(histo, HISTO_P50),
+		histo_percentile(histo, HISTO_P99), histo->max);
+}
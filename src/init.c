@@ -18,8 +18,12 @@
  *
  * @param data: Pointeur vers la structure t_data.
  *
- * @description Initialise les mutex pour les fourchettes et
- * les ressources partagées.
+ * @description Initialise le mutex d'écriture et les verrous des
+ * fourchettes, de l'implémentation choisie avec --lock. L'état partagé
+ * (morts, repas, compte des philosophes rassasiés, histogrammes) est
+ * atomique et part de zéro. Avec --processes, les verrous sont
+ * partagés entre processus. La porte de départ est fermée. Un binaire
+ * make profile prépare aussi les profils des verrous.
  *
  * @return int: Retourne SUCCESS en cas de succès, FAILURE sinon.
  *
@@ -27,25 +31,33 @@
  *
  * @examples int result = init_mutex(data_ptr);
  *
- * @dependencies Dépend de pthread_mutex_init.
+ * @dependencies Dépend de shared_mutex_init, profile_init et de
+ * data->locks.
  *
- * @control_flow 1. Initialiser le mutex des ressources partagées.
- *               2. Initialiser le mutex d'écriture.
- *               3. Initialiser les mutex des fourchettes.
+ * @control_flow 1. Initialiser le mutex d'écriture.
+ *               2. Initialiser les verrous des fourchettes.
  */
 int	init_mutex(t_data *data)
 {
 	int	i;
 
 	i = 0;
-	if (pthread_mutex_init(&data->shared_resource_mutex, NULL))
-		return (FAILURE);
-	if (pthread_mutex_init(&data->write, NULL))
+	atomic_init(&data->start_gate, GATE_CLOSED);
+	atomic_init(&data->ready, 0);
+	atomic_init(&data->finished, 0);
+	data->t0 = 0;
+	data->stop_at = 0;
+	memset(&data->histos, 0, sizeof(t_histos));
+	if (shared_mutex_init(&data->write, data->arena.shared)
+		|| profile_init(data))
 		return (FAILURE);
 	while (i < data->global_rules.n_philo)
 	{
-		if (pthread_mutex_init(&data->forks[i], NULL))
+		if (data->locks->init(&data->forks[i].lock, data->arena.shared))
 			return (FAILURE);
+		data->forks[i].taken = 0;
+		data->forks[i].waiter = NULL;
+		atomic_init(&data->forks[i].state, 0);
 		i++;
 	}
 	return (SUCCESS);
@@ -57,35 +69,102 @@ int	init_mutex(t_data *data)
  *
  * @param data: Pointeur vers la structure t_data.
  *
- * @description Alloue la mémoire pour les philosophes, les
- * identifiants de thread et les mutex des fourchettes.
+ * @description Alloue la mémoire pour les philosophes, l'anneau et le
+ * tampon de sortie du journal, les identifiants de thread, les mutex
+ * des fourchettes et le tas d'échéances du moniteur, tous découpés dans
+ * l'arène de la table.
+ * Philosophes et fourchettes sont alignés sur CACHE_LINE : chacun
+ * occupe sa propre ligne de cache.
  *
  * @return int: Retourne SUCCESS si réussi, sinon FAILURE.
  *
- * @errors/edge_effects Retourne FAILURE en cas d'échec de malloc.
+ * @errors/edge_effects Retourne FAILURE si l'arène est épuisée.
  *
  * @examples int result = init_malloc(data_ptr);
  *
- * @dependencies Dépend de malloc.
+ * @dependencies Dépend de arena_alloc.
  *
- * @control_flow 1. Allouer mémoire pour les philosophes.
+ * @control_flow 1. Allouer mémoire pour les philosophes et le journal.
  *               2. Allouer mémoire pour les identifiants de thread.
  *               3. Allouer mémoire pour les mutex des fourchettes.
+ *               4. Allouer mémoire pour le tas d'échéances et les
+ *                  moniteurs.
  */
 int	init_malloc(t_data *data)
 {
-	data->philo = malloc(sizeof(t_philo) * data->global_rules.n_philo);
-	if (!data->philo)
+	data->workers = NULL;
+	data->philo = arena_alloc(data, sizeof(t_philo)
+			* data->global_rules.n_philo);
+	data->log.ring = arena_alloc(data, sizeof(t_log_record) * LOG_RING_SIZE);
+	data->log.out = arena_alloc(data, LOG_OUT_SIZE);
+	if (!data->philo || !data->log.ring || !data->log.out)
 		return (FAILURE);
-	data->thread_ids = malloc(sizeof(pthread_t) * data->global_rules.n_philo);
+	data->thread_ids = arena_alloc(data, sizeof(pthread_t)
+			* data->global_rules.n_philo);
 	if (!data->thread_ids)
 		return (FAILURE);
-	data->forks = malloc(sizeof(pthread_mutex_t) * data->global_rules.n_philo);
+	data->forks = arena_alloc(data, sizeof(t_fork)
+			* data->global_rules.n_philo);
 	if (!data->forks)
 		return (FAILURE);
+	data->deadlines.nodes = arena_alloc(data, sizeof(t_deadline)
+			* data->global_rules.n_philo);
+	data->monitors = arena_alloc(data, sizeof(t_monitor)
+			* data->opts.n_monitors);
+	if (!data->deadlines.nodes || !data->monitors)
+		return (FAILURE);
 	return (SUCCESS);
 }
 
+/**
+ * @function init_philosophers
+ * @brief Initialise chaque philosophe.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param argv: Arguments en ligne de commande.
+ *
+ * @description Identifiant, règles partagées, dernier repas à t0,
+ * nombre de repas restants (illimité sans cinquième argument) et
+ * mesures d'attente des fourchettes à zéro. Aucun philosophe n'a encore
+ * atteint son quota.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples init_philosophers(data, argv);
+ *
+ * @dependencies Dépend de ft_atoi.
+ *
+ * @control_flow 1. Parcourir les philosophes et remplir leurs champs.
+ */
+void	init_philosophers(t_data *data, char **argv)
+{
+	int	i;
+
+	i = -1;
+	while (++i < data->global_rules.n_philo)
+	{
+		data->philo[i].shared_data = data;
+		data->philo[i].id = i + 1;
+		atomic_init(&data->philo[i].meals_eaten, INIT_MEALS_EATEN);
+		atomic_init(&data->philo[i].last_meal, INIT_LAST_MEAL);
+		data->philo[i].rules = &data->global_rules;
+		data->philo[i].eating = 0;
+		atomic_init(&data->philo[i].hungry, HUNGRY);
+		data->philo[i].hungry_at = 0;
+		atomic_init(&data->philo[i].wait_total, 0);
+		data->philo[i].wait_max = 0;
+		atomic_init(&data->philo[i].min_slack, LONG_MAX);
+		data->philo[i].started_at = 0;
+		data->philo[i].first_meal = NO_MEAL_YET;
+		if (argv[5])
+			atomic_init(&data->philo[i].remaining_meal, ft_atoi(argv[5]));
+		else
+			atomic_init(&data->philo[i].remaining_meal, UNLIMITED_MEALS);
+	}
+}
+
 /**
  * @function init
  * @brief Initialise la structure de données et alloue la mémoire.
@@ -94,44 +173,49 @@ int	init_malloc(t_data *data)
  * @param argv: Arguments en ligne de commande.
  *
  * @description Initialise les règles, alloue la mémoire, et met en place
- * les mutex et les philosophes.
+ * les mutex et les philosophes. Les durées sont stockées en microsecondes.
  *
  * @return int: Retourne SUCCESS si tout est bien initialisé, sinon FAILURE.
  *
  * @errors/edge_effects Retourne FAILURE si malloc ou init_mutex échoue.
+ * Avec un quota de repas nul, la table est arrêtée (ALL_FED) avant de
+ * commencer.
  *
  * @examples int result = init(data_ptr, argv);
  *
- * @dependencies Dépend de ft_atoi, init_malloc, init_mutex.
+ * @dependencies Dépend de ft_atoi, ft_atous, init_malloc, init_mutex,
+ * log_init, init_philosophers, init_task_scheduler, init_simulation.
  *
  * @control_flow 1. Initialiser les règles à partir des arguments.
- *               2. Allouer mémoire et initialiser mutex.
+ *               2. Allouer mémoire, initialiser mutex et journal.
  *               3. Initialiser chaque philosophe.
+ *               4. Préparer les tâches en mode --tasks ou --simulate.
  */
 int	init(t_data *data, char **argv)
 {
-	int		i;
 	t_rules	rules;
 
-	i = -1;
 	rules.n_philo = ft_atoi(argv[1]);
-	rules.t_die = ft_atoi(argv[2]);
-	rules.t_eat = ft_atoi(argv[3]);
-	rules.t_sleep = ft_atoi(argv[4]);
+	rules.t_die = ft_atous(argv[2]);
+	rules.t_eat = ft_atous(argv[3]);
+	rules.t_sleep = ft_atous(argv[4]);
 	rules.t_think = (rules.t_die - rules.t_eat - rules.t_sleep) * 0.75;
+	if (data->opts.schedule == SCHEDULE_HUNGER)
+		rules.t_think = 0;
 	data->global_rules = rules;
-	if (init_malloc(data) || init_mutex(data))
+	data->locks = get_fork_lock(data->opts.lock);
+	if (init_malloc(data) || init_mutex(data) || log_init(&data->log,
+			data->arena.shared, data->opts.trace) || init_affinity(data))
+		return (FAILURE);
+	init_philosophers(data, argv);
+	if (argv[5] && !ft_atoi(argv[5]))
+		atomic_store(&data->someone_died, ALL_FED);
+	data->strategy = get_strategy(data->opts.strategy);
+	if (data->strategy->init && data->strategy->init(data))
+		return (FAILURE);
+	if (data->opts.mode == MODE_TASKS && init_task_scheduler(data))
+		return (FAILURE);
+	if (data->opts.mode == MODE_SIMULATE && init_simulation(data))
 		return (FAILURE);
-	while (++i < rules.n_philo)
-	{
-		data->philo[i].shared_data = data;
-		data->philo[i].id = i + 1;
-		data->philo[i].last_meal = 0;
-		data->philo[i].individual_rules = rules;
-		if (argv[5])
-			data->philo[i].remaining_meal = ft_atoi(argv[5]);
-		else
-			data->philo[i].remaining_meal = UNLIMITED_MEALS;
-	}
 	return (SUCCESS);
 }
@@ -18,70 +18,79 @@
  *
  * @param philo: Pointeur vers la structure t_philo.
  *
- * @description Mise à jour de l'heure du dernier repas et impression
- * du statut. Réduit le nombre de repas restants.
+ * @description Commence le repas, attend sa durée puis le termine. Avec
+ * PHILO_HISTO, mesure l'attente entre les deux fourchettes tenues et la
+ * ligne "is eating" journalisée.
  *
  * @return void
  *
- * @errors/edge_effects Utilise des mutex, peut bloquer.
+ * @errors/edge_effects Aucun.
  *
  * @examples consume_meal_and_update_time(philo_ptr);
  *
- * @dependencies Dépend de get_time, print_meal, ft_usleep.
+ * @dependencies Dépend de start_meal, ft_usleep, finish_meal,
+ * histo_record.
  *
- * @control_flow 1. Verrouiller shared_resource_mutex.
- *               2. Mise à jour last_meal.
- *               3. Déverrouiller et impression.
- *               4. Attendre pour manger.
- *               5. Réduire remaining_meal.
+ * @control_flow 1. Commencer le repas.
+ *               2. Attendre pour manger.
+ *               3. Terminer le repas.
  */
 void	consume_meal_and_update_time(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->shared_data->shared_resource_mutex);
-	philo->last_meal = get_time(philo->shared_data->t0);
-	pthread_mutex_unlock(&philo->shared_data->shared_resource_mutex);
-	pthread_mutex_lock(&philo->shared_data->write);
-	print_meal(philo);
-	pthread_mutex_unlock(&philo->shared_data->write);
-	ft_usleep(philo->shared_data, philo->individual_rules.t_eat);
-	pthread_mutex_lock(&philo->shared_data->shared_resource_mutex);
-	philo->remaining_meal--;
-	pthread_mutex_unlock(&philo->shared_data->shared_resource_mutex);
+	long	forks_at;
+
+	forks_at = 0;
+	if (HISTO_ENABLED)
+		forks_at = get_time(philo->shared_data->t0);
+	start_meal(philo);
+	if (HISTO_ENABLED)
+		histo_record(&philo->shared_data->histos.fork_to_eat,
+			atomic_load_explicit(&philo->last_meal, memory_order_relaxed)
+			- forks_at);
+	ft_usleep(philo->shared_data, philo->rules->t_eat);
+	finish_meal(philo);
 }
 
 /**
  * @function attempt_fork_lock_and_eat
- * @brief Tente de prendre des fourchettes et de manger.
+ * @brief Prend les fourchettes selon la stratégie choisie et mange.
  *
  * @param philo: Pointeur vers t_philo.
- * @param first_fork: Index de la première fourchette.
- * @param second_fork: Index de la seconde fourchette.
  *
- * @description Tente de verrouiller les deux fourchettes adjacentes. 
- * Si réussi, le philosophe consomme un repas.
+ * @description La prise et le rendu des fourchettes sont délégués à la
+ * stratégie (--strategy) : ordre pair/impair par défaut, hiérarchie,
+ * serveur ou Chandy/Misra. Avec --schedule=hunger, le philosophe cède
+ * d'abord le passage aux voisins plus proches de la mort.
  *
  * @return void
  *
- * @errors/edge_effects Utilise des mutex, peut bloquer.
+ * @errors/edge_effects Peut bloquer jusqu'à obtenir les fourchettes. Une
+ * stratégie qui abandonne (mort) ne fait pas manger.
  *
- * @examples attempt_fork_lock_and_eat(philo_ptr, fork1, fork2);
+ * @examples attempt_fork_lock_and_eat(philo_ptr);
  *
- * @dependencies Dépend de consume_meal_and_update_time.
+ * @dependencies Dépend de note_hungry, yield_to_hungrier, clear_hunger,
+ * de la stratégie et de consume_meal_and_update_time.
  *
- * @control_flow 1. Verrouiller les fourchettes.
- *               2. Si réussi, manger.
- *               3. Déverrouiller les fourchettes.
+ * @control_flow 1. Noter le début de l'attente.
+ *               2. En mode hunger, céder aux voisins prioritaires.
+ *               3. Prendre les fourchettes.
+ *               4. Si réussi, manger puis rendre les fourchettes.
  */
-void	attempt_fork_lock_and_eat(t_philo *philo, int first_fork,
-	int second_fork)
+void	attempt_fork_lock_and_eat(t_philo *philo)
 {
-	if (!pthread_mutex_lock(&philo->shared_data->forks[first_fork])
-		&& !pthread_mutex_lock(&philo->shared_data->forks[second_fork]))
-	{
-		consume_meal_and_update_time(philo);
-	}
-	pthread_mutex_unlock(&philo->shared_data->forks[second_fork]);
-	pthread_mutex_unlock(&philo->shared_data->forks[first_fork]);
+	t_strategy	*strategy;
+
+	strategy = philo->shared_data->strategy;
+	note_hungry(philo);
+	if (philo->shared_data->opts.schedule == SCHEDULE_HUNGER)
+		yield_to_hungrier(philo);
+	if (strategy->take(philo))
+		return ;
+	if (philo->shared_data->opts.schedule == SCHEDULE_HUNGER)
+		clear_hunger(philo);
+	consume_meal_and_update_time(philo);
+	strategy->put(philo);
 }
 
 /**
@@ -91,8 +100,8 @@ void	attempt_fork_lock_and_eat(t_philo *philo, int first_fork,
  *
  * @param philo: Pointeur vers la structure t_philo.
  *
- * @description Selon l'ID du philosophe, identifie les fourchettes adjacentes
- * et lance la tentative de les verrouiller pour manger.
+ * @description Un philosophe seul n'a qu'une fourchette et ne mange
+ * jamais ; les autres tentent de prendre leurs fourchettes pour manger.
  *
  * @return void
  *
@@ -100,66 +109,43 @@ void	attempt_fork_lock_and_eat(t_philo *philo, int first_fork,
  *
  * @examples initiate_eating_process(philo_ptr);
  *
- * @dependencies Dépend de la fonction attempt_fork_lock_and_eat.
+ * @dependencies Dépend de attempt_fork_lock_and_eat.
  *
  * @control_flow 1. Vérifier si le philosophe est seul.
- *               2. Identifier les fourchettes adjacentes.
- *               3. Lancer la tentative de verrouillage et de manger.
+ *               2. Lancer la tentative de verrouillage et de manger.
  */
 void	initiate_eating_process(t_philo *philo)
 {
-	int	first_fork;
-	int	second_fork;
-
-	if (philo->individual_rules.n_philo == ALONE)
+	if (philo->rules->n_philo == ALONE)
 		return ;
-	if (philo->id % 2 == 0)
-	{
-		first_fork = philo->id - 1;
-		second_fork = philo->id % philo->individual_rules.n_philo;
-	}
-	else if (philo->id % 2 != 0)
-	{
-		first_fork = philo->id % philo->individual_rules.n_philo;
-		second_fork = philo->id - 1;
-	}
-	attempt_fork_lock_and_eat(philo, first_fork, second_fork);
+	attempt_fork_lock_and_eat(philo);
 }
 
 /**
  * @function        print_action_and_wait
  * @brief           Affiche une action du philosophe et attend un temps donné.
  * @param t_philo   *philo - Pointeur vers la structure du philosophe.
- * @param const     *action - L'action à afficher.
- * @param int       time_to_action - Temps à attendre en millisecondes.
+ * @param int       event - Code LOG_EV_* de l'action à journaliser.
+ * @param long      time_to_action - Temps à attendre en microsecondes.
  * 
- * @description     Verrouille le mutex de l'écriture, vérifie si le philosophe
- *                  doit continuer et affiche l'action. Ensuite, déverrouille 
- *                  le mutex et fait attendre le thread pour time_to_action.
+ * @description     Journalise l'action puis fait attendre le thread pour
+ *                  time_to_action.
  * 
  * @return          Aucun.
  * 
  * @side_effect     Peut verrouiller et déverrouiller un mutex.
  * 
- * @example         print_action_and_wait(philo, "is eating", 500);
+ * @example         print_action_and_wait(philo, LOG_EV_SLEEPING, 500000);
  * 
- * @dependencies    pthread_mutex_lock, pthread_mutex_unlock, printf, ft_usleep
+ * @dependencies    log_action, ft_usleep
  * 
- * @control_flow    1. Verrouiller le mutex.
- *                  2. Vérification de la condition de continuation.
- *                  3. Affichage de l'action.
- *                  4. Déverrouillage du mutex.
- *                  5. Appel de ft_usleep pour attendre.
+ * @control_flow    1. Journalisation de l'action.
+ *                  2. Appel de ft_usleep pour attendre.
  */
-void	print_action_and_wait(t_philo *philo, const char *action,
-	int time_to_action)
+void	print_action_and_wait(t_philo *philo, int event,
+	long time_to_action)
 {
-	pthread_mutex_lock(&philo->shared_data->write);
-	if (!should_philo_continue(philo->shared_data, philo)
-		&& philo->individual_rules.n_philo > 1)
-		printf(action, get_time(philo->shared_data->t0),
-			philo->id);
-	pthread_mutex_unlock(&philo->shared_data->write);
+	log_action(philo, event);
 	ft_usleep(philo->shared_data, time_to_action);
 }
 
@@ -172,6 +158,9 @@ void	print_action_and_wait(t_philo *philo, const char *action,
  * @description     Initialisée par pthread_create, cette fonction prend en 
  *                  paramètre une "valise" qui est un pointeur vers t_philo.
  *                  Elle exécute les actions de manger, dormir et penser.
+ *                  Avec --schedule=hunger, ni décalage des impairs ni
+ *                  temps de réflexion : yield_to_hungrier ordonne les
+ *                  voisins.
  * 
  * @return          Pointeur vers void (NULL si le philosophe doit s'arrêter).
  * 
@@ -184,7 +173,7 @@ void	print_action_and_wait(t_philo *philo, const char *action,
  *                  should_philo_continue
  * 
  * @control_flow    1. Conversion du pointeur valise en pointeur t_philo.
- *                  2. Pause conditionnelle si id est impair.
+ *                  2. Pause conditionnelle si id est impair (static).
  *                  3. Boucle infinie pour réaliser les actions.
  *                  4. Vérification de la condition de continuation.
  */
@@ -193,15 +182,19 @@ void	*run_philosopher_routine(void *valise)
 	t_philo	*philo;
 
 	philo = (t_philo *) valise;
-	if (philo->id % 2)
-		usleep(philo->individual_rules.t_eat);
+	affinity_pin(philo->shared_data, pthread_self(), philo->id - 1,
+		philo->rules->n_philo);
+	wait_start_gate(philo);
+	if (philo->id % 2 && philo->shared_data->opts.schedule
+		== SCHEDULE_STATIC)
+		usleep(philo->rules->t_eat / US_TO_MS);
 	while (INFINITY_LOOP)
 	{
 		initiate_eating_process(philo);
-		print_action_and_wait(philo, LOG_SLEEPING,
-			philo->individual_rules.t_sleep);
-		print_action_and_wait(philo, LOG_THINKING,
-			philo->individual_rules.t_think);
+		print_action_and_wait(philo, LOG_EV_SLEEPING,
+			philo->rules->t_sleep);
+		print_action_and_wait(philo, LOG_EV_THINKING,
+			philo->rules->t_think);
 		if (should_philo_continue(philo->shared_data, philo))
 			return ((void *) 0);
 	}
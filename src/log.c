@@ -0,0 +1,236 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:12:41 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 10:12:41 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function wait_log_space
+ * @brief Attend une place libre dans l'anneau plein.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param head: Tête que le producteur veut écrire.
+ *
+ * @description Réveille le thread de vidage puis se gare LOG_BACKOFF_US
+ * sur le jeton d'arrêt someone_died : l'arrêt réveille aussi les
+ * producteurs en contre-pression. Après l'arrêt, plus de pause : la
+ * place est attendue en cédant le CPU, car la ligne "died" attend le
+ * mutex d'écriture que tient ce producteur.
+ *
+ * @return int: SUCCESS si une place s'est libérée, FAILURE si le vidage
+ * est arrêté (l'enregistrement est alors compté comme perdu).
+ *
+ * @errors/edge_effects L'enregistrement en attente n'est jamais jeté à
+ * cause de l'arrêt : il précède la mort.
+ *
+ * @examples if (wait_log_space(data, head))
+ *
+ * @dependencies Dépend de log_wake_flusher, syscall et sched_yield.
+ *
+ * @control_flow 1. Tant que l'anneau est plein, réveiller le vidage.
+ *               2. Attendre l'arrêt au plus LOG_BACKOFF_US, ou céder le
+ *                  CPU après l'arrêt.
+ */
+int	wait_log_space(t_data *data, unsigned long head)
+{
+	t_log			*log;
+	struct timespec	backoff;
+
+	log = &data->log;
+	backoff.tv_sec = 0;
+	backoff.tv_nsec = LOG_BACKOFF_US * US_TO_NS;
+	while (head - atomic_load_explicit(&log->tail, memory_order_acquire)
+		>= LOG_RING_SIZE)
+	{
+		if (!atomic_load_explicit(&log->running, memory_order_acquire))
+		{
+			atomic_fetch_add_explicit(&log->dropped, 1, memory_order_relaxed);
+			return (FAILURE);
+		}
+		log_wake_flusher(log);
+		if (atomic_load_explicit(&data->someone_died, memory_order_acquire))
+			sched_yield();
+		else
+			syscall(SYS_futex, (int *)&data->someone_died, FUTEX_WAIT,
+				NO_ONE_DIED, &backoff, NULL, 0);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function log_push
+ * @brief Dépose un enregistrement dans l'anneau de journalisation.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param time: Horodatage de l'évènement en microsecondes.
+ * @param id: Identifiant du philosophe.
+ * @param event: Code LOG_EV_* de l'évènement.
+ *
+ * @description Producteur de l'anneau MPSC. L'appelant tient le mutex
+ * 'write', qui sérialise les producteurs sans jamais toucher stdio :
+ * l'horodatage et l'ordre de dépôt restent donc cohérents.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Si l'anneau est plein, attend le vidage et compte
+ * une contre-pression. Si le vidage est arrêté, l'enregistrement est
+ * compté comme perdu.
+ *
+ * @examples log_push(data_ptr, 200000, 3, LOG_EV_EAT);
+ *
+ * @dependencies Dépend de wait_log_space.
+ *
+ * @control_flow 1. Attendre une place libre.
+ *               2. Écrire l'enregistrement.
+ *               3. Publier la nouvelle tête.
+ */
+void	log_push(t_data *data, long time, int id, int event)
+{
+	t_log			*log;
+	unsigned long	head;
+	t_log_record	*record;
+
+	log = &data->log;
+	head = atomic_load_explicit(&log->head, memory_order_relaxed);
+	if (head - atomic_load_explicit(&log->tail, memory_order_acquire)
+		>= LOG_RING_SIZE)
+		log->backpressured++;
+	if (wait_log_space(data, head))
+		return ;
+	record = &log->ring[head & (LOG_RING_SIZE - 1)];
+	record->time = time;
+	record->id = id;
+	record->event = event;
+	atomic_store_explicit(&log->head, head + 1, memory_order_release);
+}
+
+/**
+ * @function emit_log_record
+ * @brief Envoie un enregistrement vers stdout ou vers la trace.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ * @param record: Pointeur vers l'enregistrement.
+ *
+ * @description Avec --trace, l'enregistrement est encodé en binaire
+ * dans le fichier de trace, sans aucun formatage ; philo-decode le
+ * rendra plus tard sous sa forme texte. Sinon, il est imprimé.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Un enregistrement que la trace ne peut plus
+ * recevoir est compté comme perdu.
+ *
+ * @examples emit_log_record(&data->log, &record);
+ *
+ * @dependencies Dépend de trace_append et print_log_record.
+ *
+ * @control_flow 1. Encoder si la trace est ouverte.
+ *               2. Sinon imprimer.
+ */
+void	emit_log_record(t_log *log, t_log_record *record)
+{
+	if (log->trace.fd == TRACE_CLOSED)
+		print_log_record(log, record);
+	else if (trace_append(&log->trace, record))
+		atomic_fetch_add_explicit(&log->dropped, 1, memory_order_relaxed);
+}
+
+/**
+ * @function drain_log
+ * @brief Vide en un lot tous les enregistrements disponibles.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ *
+ * @description Consommateur unique : formate chaque enregistrement dans
+ * le tampon de sortie du journal puis écrit le lot entier d'un seul
+ * write.
+ *
+ * @return unsigned long: Nombre d'enregistrements vidés.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples n = drain_log(&data->log);
+ *
+ * @dependencies Dépend de emit_log_record et flush_log_output.
+ *
+ * @control_flow 1. Lire la tête publiée.
+ *               2. Formater jusqu'à la tête.
+ *               3. Libérer les places et écrire le lot.
+ */
+unsigned long	drain_log(t_log *log)
+{
+	unsigned long	tail;
+	unsigned long	head;
+	unsigned long	count;
+
+	tail = atomic_load_explicit(&log->tail, memory_order_relaxed);
+	head = atomic_load_explicit(&log->head, memory_order_acquire);
+	count = head - tail;
+	while (tail != head)
+	{
+		emit_log_record(log, &log->ring[tail & (LOG_RING_SIZE - 1)]);
+		tail++;
+	}
+	atomic_store_explicit(&log->tail, tail, memory_order_release);
+	if (count)
+		flush_log_output(log);
+	return (count);
+}
+
+/**
+ * @function run_log_flusher
+ * @brief Routine du thread de vidage du journal.
+ *
+ * @param valise: Pointeur générique vers la structure t_log.
+ *
+ * @description Vide l'anneau par lots, puis dort au plus
+ * LOG_FLUSH_INTERVAL_US ou jusqu'à un réveil explicite. Sort une fois
+ * arrêté et l'anneau vide.
+ *
+ * @return void *: Toujours NULL.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples pthread_create(&log->flusher, NULL, run_log_flusher, log);
+ *
+ * @dependencies Dépend de drain_log et pthread_cond_timedwait.
+ *
+ * @control_flow 1. Lire l'état d'exécution.
+ *               2. Vider l'anneau.
+ *               3. Sortir ou attendre le prochain lot.
+ */
+void	*run_log_flusher(void *valise)
+{
+	t_log			*log;
+	int				running;
+	struct timespec	deadline;
+
+	log = (t_log *) valise;
+	while (INFINITY_LOOP)
+	{
+		running = atomic_load_explicit(&log->running, memory_order_acquire);
+		if (drain_log(log))
+			continue ;
+		if (!running)
+			return (NULL);
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_nsec += LOG_FLUSH_INTERVAL_US * US_TO_NS;
+		deadline.tv_sec += deadline.tv_nsec / SEC_TO_NS;
+		deadline.tv_nsec %= SEC_TO_NS;
+		shared_mutex_lock(&log->lock);
+		if (atomic_load_explicit(&log->head, memory_order_acquire)
+			== atomic_load_explicit(&log->tail, memory_order_relaxed))
+			if (pthread_cond_timedwait(&log->wake, &log->lock, &deadline)
+				== EOWNERDEAD)
+				pthread_mutex_consistent(&log->lock);
+		pthread_mutex_unlock(&log->lock);
+	}
+}
@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_control.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:31:07 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 10:31:07 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function log_init
+ * @brief Initialise l'anneau de journalisation.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ * @param shared: Non nul si des processus ouvriers produisent aussi.
+ * @param trace: Fichier de --trace, ou NULL pour imprimer sur stdout.
+ *
+ * @description L'anneau est alloué par init_malloc. Initialise les
+ * compteurs atomiques, le mutex et la condition de réveil du thread de
+ * vidage. La condition est réglée sur CLOCK_MONOTONIC ; avec shared,
+ * mutex et condition sont partagés entre processus. Ouvre la trace
+ * binaire si elle est demandée.
+ *
+ * @return int: Retourne SUCCESS si réussi, sinon FAILURE.
+ *
+ * @errors/edge_effects Retourne FAILURE en cas d'échec de
+ * l'initialisation des primitives ou de l'ouverture de la trace.
+ *
+ * @examples if (log_init(&data->log, 0, NULL))
+ *
+ * @dependencies Dépend de shared_mutex_init, pthread_cond_init et
+ * trace_open.
+ *
+ * @control_flow 1. Initialiser les compteurs.
+ *               2. Initialiser mutex et condition.
+ *               3. Ouvrir la trace.
+ */
+int	log_init(t_log *log, int shared, const char *trace)
+{
+	pthread_condattr_t	attr;
+
+	atomic_init(&log->head, 0);
+	atomic_init(&log->tail, 0);
+	atomic_init(&log->running, LOG_STOPPED);
+	atomic_init(&log->dropped, 0);
+	log->backpressured = 0;
+	log->trace.fd = TRACE_CLOSED;
+	log->out_len = 0;
+	if (shared_mutex_init(&log->lock, shared))
+		return (FAILURE);
+	if (pthread_condattr_init(&attr)
+		|| pthread_condattr_setclock(&attr, CLOCK_MONOTONIC)
+		|| (shared && pthread_condattr_setpshared(&attr,
+				PTHREAD_PROCESS_SHARED))
+		|| pthread_cond_init(&log->wake, &attr))
+		return (FAILURE);
+	pthread_condattr_destroy(&attr);
+	if (trace && trace_open(&log->trace, trace))
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @function log_wake_flusher
+ * @brief Réveille le thread de vidage.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ *
+ * @description Utilisé pour les évènements qui doivent sortir sans
+ * attendre l'intervalle de vidage : la mort et l'arrêt.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples log_wake_flusher(&data->log);
+ *
+ * @dependencies Dépend de pthread_cond_signal.
+ *
+ * @control_flow 1. Prendre le mutex du journal.
+ *               2. Signaler la condition.
+ *               3. Libérer le mutex.
+ */
+void	log_wake_flusher(t_log *log)
+{
+	shared_mutex_lock(&log->lock);
+	pthread_cond_signal(&log->wake);
+	pthread_mutex_unlock(&log->lock);
+}
+
+/**
+ * @function log_start
+ * @brief Lance le thread de vidage du journal.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ *
+ * @description Marque le journal comme actif puis crée le thread qui
+ * formate et écrit les enregistrements.
+ *
+ * @return int: Retourne SUCCESS ou FAILURE_CREAT_THREADS.
+ *
+ * @errors/edge_effects En cas d'échec, le journal repasse à l'arrêt et
+ * les producteurs comptent leurs enregistrements comme perdus.
+ *
+ * @examples if (log_start(&data->log))
+ *
+ * @dependencies Dépend de pthread_create et run_log_flusher.
+ *
+ * @control_flow 1. Marquer le journal actif.
+ *               2. Créer le thread de vidage.
+ */
+int	log_start(t_log *log)
+{
+	atomic_store_explicit(&log->running, LOG_RUNNING, memory_order_release);
+	if (pthread_create(&log->flusher, NULL, &run_log_flusher, log))
+	{
+		atomic_store_explicit(&log->running, LOG_STOPPED,
+			memory_order_release);
+		return (FAILURE_CREAT_THREADS);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function log_stop
+ * @brief Arrête le thread de vidage après un dernier lot.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ *
+ * @description Marque le journal comme arrêté, réveille le thread de
+ * vidage qui vide l'anneau une dernière fois, puis le rejoint.
+ *
+ * @return int: Retourne SUCCESS ou FAILURE_JOIN_THREADS.
+ *
+ * @errors/edge_effects À appeler après la jointure des philosophes :
+ * plus aucun producteur ne doit être actif.
+ *
+ * @examples if (log_stop(&data->log))
+ *
+ * @dependencies Dépend de log_wake_flusher et pthread_join.
+ *
+ * @control_flow 1. Marquer le journal arrêté.
+ *               2. Réveiller et rejoindre le thread de vidage.
+ */
+int	log_stop(t_log *log)
+{
+	atomic_store_explicit(&log->running, LOG_STOPPED, memory_order_release);
+	log_wake_flusher(log);
+	if (pthread_join(log->flusher, NULL))
+		return (FAILURE_JOIN_THREADS);
+	return (SUCCESS);
+}
+
+/**
+ * @function log_destroy
+ * @brief Rapporte les compteurs du journal et détruit ses primitives.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ *
+ * @description Si des enregistrements ont subi une contre-pression ou
+ * ont été perdus, l'indique sur stderr ; la sortie standard reste
+ * identique au format historique. Ferme la trace à sa longueur exacte.
+ *
+ * @return int: Retourne SUCCESS en cas de succès, FAILURE sinon.
+ *
+ * @errors/edge_effects Retourne FAILURE si la trace ne peut être
+ * fermée, ou si un mutex ou une condition ne peut être détruit.
+ *
+ * @examples if (log_destroy(&data->log))
+ *
+ * @dependencies Dépend de fprintf, trace_close, pthread_mutex_destroy.
+ *
+ * @control_flow 1. Rapporter les compteurs.
+ *               2. Fermer la trace.
+ *               3. Détruire mutex et condition.
+ */
+int	log_destroy(t_log *log)
+{
+	if (log->backpressured || atomic_load(&log->dropped))
+		fprintf(stderr, LOG_STATS, atomic_load(&log->head),
+			log->backpressured, atomic_load(&log->dropped));
+	if (trace_close(&log->trace) || pthread_mutex_destroy(&log->lock)
+		|| pthread_cond_destroy(&log->wake))
+		return (FAILURE);
+	return (SUCCESS);
+}
@@ -0,0 +1,211 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:12:44 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 01:12:44 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function format_long
+ * @brief Écrit un entier en décimal, sans printf.
+ *
+ * @param out: Tampon d'au moins LOG_LONG_DIGITS octets.
+ * @param value: Valeur à écrire.
+ *
+ * @description Compte d'abord les chiffres, puis les écrit de droite à
+ * gauche : aucun tampon intermédiaire ni recopie. Même rendu que %ld.
+ *
+ * @return size_t: Nombre d'octets écrits.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples len = format_long(out, record->time / US_TO_MS);
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Écrire le signe.
+ *               2. Compter les chiffres.
+ *               3. Les écrire depuis la fin.
+ */
+size_t	format_long(char *out, long value)
+{
+	unsigned long	digits;
+	unsigned long	rest;
+	size_t			len;
+
+	len = 0;
+	digits = value;
+	if (value < 0)
+	{
+		out[len++] = '-';
+		digits = -digits;
+	}
+	rest = digits;
+	while (rest >= 10 && ++len)
+		rest /= 10;
+	out[len] = '0' + digits % 10;
+	rest = len;
+	while (digits >= 10)
+	{
+		digits /= 10;
+		out[--rest] = '0' + digits % 10;
+	}
+	return (len + 1);
+}
+
+/**
+ * @function log_event_text
+ * @brief Donne la fin de ligne d'un code d'évènement.
+ *
+ * @param event: Code LOG_EV_*.
+ * @param len: Reçoit la longueur du texte.
+ *
+ * @description Le texte qui suit l'identifiant dans les formats LOG_*,
+ * '\n' compris. Les longueurs sont connues à la compilation.
+ *
+ * @return const char*: Le texte, ou NULL pour un code inconnu.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples text = log_event_text(record->event, &len);
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Sélectionner le texte.
+ */
+const char	*log_event_text(int event, size_t *len)
+{
+	*len = sizeof(LOG_TEXT_FORK) - 1;
+	if (event == LOG_EV_FORK)
+		return (LOG_TEXT_FORK);
+	*len = sizeof(LOG_TEXT_EAT) - 1;
+	if (event == LOG_EV_EAT)
+		return (LOG_TEXT_EAT);
+	*len = sizeof(LOG_TEXT_SLEEPING) - 1;
+	if (event == LOG_EV_SLEEPING)
+		return (LOG_TEXT_SLEEPING);
+	*len = sizeof(LOG_TEXT_THINKING) - 1;
+	if (event == LOG_EV_THINKING)
+		return (LOG_TEXT_THINKING);
+	*len = sizeof(LOG_TEXT_DIED) - 1;
+	if (event == LOG_EV_DIED)
+		return (LOG_TEXT_DIED);
+	*len = 0;
+	return (NULL);
+}
+
+/**
+ * @function format_log_record
+ * @brief Formate un enregistrement au format LOG_* historique.
+ *
+ * @param out: Tampon d'au moins LOG_LINE_MAX octets.
+ * @param record: Pointeur vers l'enregistrement.
+ *
+ * @description "<ms> <id><texte>" : la sortie reste identique octet pour
+ * octet à printf et aux formats LOG_*. L'horodatage interne en
+ * microsecondes est tronqué en millisecondes.
+ *
+ * @return size_t: Longueur de la ligne, 0 pour un code inconnu.
+ *
+ * @errors/edge_effects Un code inconnu n'écrit rien.
+ *
+ * @examples log->out_len += format_log_record(log->out + len, record);
+ *
+ * @dependencies Dépend de format_long et log_event_text.
+ *
+ * @control_flow 1. Horodatage et identifiant.
+ *               2. Texte de l'évènement.
+ */
+size_t	format_log_record(char *out, t_log_record *record)
+{
+	const char	*text;
+	size_t		text_len;
+	size_t		len;
+
+	text = log_event_text(record->event, &text_len);
+	if (!text)
+		return (0);
+	len = format_long(out, record->time / US_TO_MS);
+	out[len++] = ' ';
+	len += format_long(out + len, record->id);
+	memcpy(out + len, text, text_len);
+	return (len + text_len);
+}
+
+/**
+ * @function print_log_record
+ * @brief Ajoute un enregistrement formaté au tampon de sortie.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ * @param record: Pointeur vers l'enregistrement.
+ *
+ * @description Le tampon, alloué une fois dans l'arène, n'est écrit
+ * que lorsqu'il ne peut plus recevoir une ligne entière, ou à la fin du
+ * lot par flush_log_output.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples print_log_record(log, &log->ring[0]);
+ *
+ * @dependencies Dépend de format_log_record et flush_log_output.
+ *
+ * @control_flow 1. Vider le tampon s'il est plein.
+ *               2. Formater à sa suite.
+ */
+void	print_log_record(t_log *log, t_log_record *record)
+{
+	if (log->out_len + LOG_LINE_MAX > LOG_OUT_SIZE)
+		flush_log_output(log);
+	log->out_len += format_log_record(log->out + log->out_len, record);
+}
+
+/**
+ * @function flush_log_output
+ * @brief Écrit le tampon de sortie d'un seul write.
+ *
+ * @param log: Pointeur vers la structure t_log.
+ *
+ * @description Remplace stdio : un appel système par lot de lignes.
+ * Une écriture partielle, possible sur un tube, est complétée.
+ *
+ * @return int: SUCCESS, ou FAILURE si write échoue ; le lot est alors
+ * perdu.
+ *
+ * @errors/edge_effects EINTR est retenté.
+ *
+ * @examples flush_log_output(log);
+ *
+ * @dependencies Dépend de write.
+ *
+ * @control_flow 1. Écrire tant qu'il reste des octets.
+ *               2. Vider le tampon.
+ */
+int	flush_log_output(t_log *log)
+{
+	size_t	sent;
+	ssize_t	written;
+
+	sent = 0;
+	while (sent < log->out_len)
+	{
+		written = write(STDOUT_FILENO, log->out + sent, log->out_len - sent);
+		if (written < 0 && errno != EINTR)
+			break ;
+		if (written > 0)
+			sent += written;
+	}
+	written = sent < log->out_len;
+	log->out_len = 0;
+	if (written)
+		return (FAILURE);
+	return (SUCCESS);
+}
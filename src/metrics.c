@@ -0,0 +1,198 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function metrics_open
+ * @brief Crée le segment nommé où sont publiées les métriques.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Contrairement à l'arène, le nom METRICS_NAME reste lié
+ * pendant toute la course : c'est par lui que philo-top retrouve le
+ * segment à partir du pid. L'en-tête t_metrics est suivi d'une entrée
+ * t_metrics_philo par philosophe.
+ *
+ * @return int: SUCCESS, ou FAILURE si le segment n'a pas pu être créé.
+ *
+ * @errors/edge_effects Le nom est fixé par metrics_start. En cas
+ * d'échec, il est délié et shm reste NULL.
+ *
+ * @examples if (metrics_open(data))
+ *
+ * @dependencies Dépend de shm_open, ftruncate, mmap et shm_unlink.
+ *
+ * @control_flow 1. Dimensionner et créer le segment.
+ *               2. Le projeter et écrire les champs fixes.
+ */
+int	metrics_open(t_data *data)
+{
+	t_publisher	*pub;
+	void		*base;
+	int			fd;
+
+	pub = &data->publisher;
+	pub->size = sizeof(t_metrics)
+		+ sizeof(t_metrics_philo) * data->global_rules.n_philo;
+	fd = shm_open(pub->name, O_RDWR | O_CREAT | O_EXCL, SHM_MODE);
+	if (fd < 0)
+		return (FAILURE);
+	base = MAP_FAILED;
+	if (!ftruncate(fd, pub->size))
+		base = mmap(NULL, pub->size, PROT_READ | PROT_WRITE, MAP_SHARED,
+				fd, 0);
+	close(fd);
+	if (base == MAP_FAILED)
+	{
+		shm_unlink(pub->name);
+		return (FAILURE);
+	}
+	pub->shm = base;
+	pub->shm->n_philo = data->global_rules.n_philo;
+	pub->shm->n_monitors = data->opts.n_monitors;
+	return (SUCCESS);
+}
+
+/**
+ * @function metrics_close
+ * @brief Libère le segment des métriques et délie son nom.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Un lecteur qui l'a déjà projeté garde sa projection ;
+ * un nouveau lecteur ne trouve plus le segment.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Sans effet si le segment n'existe pas.
+ *
+ * @examples metrics_close(data);
+ *
+ * @dependencies Dépend de munmap et shm_unlink.
+ *
+ * @control_flow 1. Détacher puis délier le segment.
+ */
+void	metrics_close(t_data *data)
+{
+	if (!data->publisher.shm)
+		return ;
+	munmap(data->publisher.shm, data->publisher.size);
+	shm_unlink(data->publisher.name);
+	data->publisher.shm = NULL;
+}
+
+/**
+ * @function metrics_start
+ * @brief Lance l'éditeur des métriques avec --metrics.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Appelée une fois la barrière de départ ouverte, quand t0
+ * ne bouge plus. L'observation est accessoire : un échec est signalé
+ * sur la sortie d'erreur et la course continue sans métriques.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Sans --metrics, ne fait rien. Un philo tué
+ * (SIGINT, SIGKILL) laisse son segment dans /dev/shm. Le nom ne porte
+ * que le pid, qu'aucun processus vivant ne partage avec nous : un
+ * segment déjà présent est le reste d'une course morte, délié avant
+ * la création exclusive.
+ *
+ * @examples metrics_start(data);
+ *
+ * @dependencies Dépend de shm_unlink, metrics_open, pthread_create et
+ * run_metrics.
+ *
+ * @control_flow 1. Nommer le segment, délier un reste, le créer.
+ *               2. Créer le thread éditeur, ou tout défaire.
+ */
+void	metrics_start(t_data *data)
+{
+	if (!data->opts.metrics)
+		return ;
+	snprintf(data->publisher.name, SHM_NAME_LEN, METRICS_NAME, getpid());
+	shm_unlink(data->publisher.name);
+	if (metrics_open(data)
+		|| pthread_create(&data->publisher.thread, NULL, &run_metrics, data))
+	{
+		fprintf(stderr, ERR_METRICS, data->publisher.name);
+		metrics_close(data);
+	}
+}
+
+/**
+ * @function run_metrics
+ * @brief Corps de l'éditeur : une publication par intervalle.
+ *
+ * @param valise: Pointeur vers la structure t_data.
+ *
+ * @description Publie toutes les METRICS_INTERVAL_US, en attendant sur
+ * le mot someone_died : l'arrêt de la table réveille l'éditeur, qui
+ * publie un dernier instantané portant l'état final avant de sortir.
+ *
+ * @return void*: Toujours NULL.
+ *
+ * @errors/edge_effects Pas d'attente active : l'éditeur ne dispute le
+ * CPU aux philosophes que le temps d'une publication.
+ *
+ * @examples pthread_create(&pub->thread, NULL, &run_metrics, data);
+ *
+ * @dependencies Dépend de publish_metrics et futex_wait_until.
+ *
+ * @control_flow 1. Publier puis attendre l'intervalle ou l'arrêt.
+ *               2. Publier l'instantané final.
+ */
+void	*run_metrics(void *valise)
+{
+	t_data	*data;
+
+	data = valise;
+	while (!atomic_load_explicit(&data->someone_died, memory_order_acquire))
+	{
+		publish_metrics(data);
+		futex_wait_until(&data->someone_died, NO_ONE_DIED,
+			get_time(0) + METRICS_INTERVAL_US);
+	}
+	publish_metrics(data);
+	return (NULL);
+}
+
+/**
+ * @function metrics_stop
+ * @brief Attend l'éditeur puis retire le segment des métriques.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Appelée quand les moniteurs rendent la main :
+ * someone_died est alors levé et l'éditeur sort après son dernier
+ * instantané, sans attendre la jointure des philosophes.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Sans éditeur lancé, ne fait rien.
+ *
+ * @examples metrics_stop(data);
+ *
+ * @dependencies Dépend de pthread_join et metrics_close.
+ *
+ * @control_flow 1. Joindre l'éditeur.
+ *               2. Fermer le segment.
+ */
+void	metrics_stop(t_data *data)
+{
+	if (!data->publisher.shm)
+		return ;
+	pthread_join(data->publisher.thread, NULL);
+	metrics_close(data);
+}
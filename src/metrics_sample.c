@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_sample.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:31:05 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 09:31:05 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function sample_philos
+ * @brief Relève l'état de chaque philosophe dans l'instantané.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param now: Horodatage de l'instantané, relatif à t0.
+ *
+ * @description Ne lit que des atomiques, en relâché : last_meal,
+ * meals_eaten, wait_total et min_slack n'ont chacun qu'un écrivain, le
+ * philosophe, qui ne voit jamais l'éditeur. Remplit aussi les totaux
+ * de l'en-tête.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Les champs d'un même philosophe peuvent venir de
+ * deux repas voisins : l'instantané est cohérent par champ, pas entre
+ * philosophes.
+ *
+ * @examples sample_philos(data, now);
+ *
+ * @dependencies Dépend de atomic_load_explicit.
+ *
+ * @control_flow 1. Pour chaque philosophe, âge du repas et marge.
+ *               2. Cumuler repas, attentes et marge minimale.
+ */
+void	sample_philos(t_data *data, long now)
+{
+	t_metrics_philo	*out;
+	t_philo			*philo;
+	long			slack;
+	int				i;
+
+	i = 0;
+	while (i < data->global_rules.n_philo)
+	{
+		philo = &data->philo[i];
+		out = &data->publisher.shm->philo[i++];
+		out->last_meal_age = now - atomic_load_explicit(&philo->last_meal,
+				memory_order_relaxed);
+		out->slack = philo->rules->t_die - out->last_meal_age;
+		out->meals = atomic_load_explicit(&philo->meals_eaten,
+				memory_order_relaxed);
+		out->fork_wait = atomic_load_explicit(&philo->wait_total,
+				memory_order_relaxed);
+		data->publisher.shm->meals += out->meals;
+		data->publisher.shm->fork_wait += out->fork_wait;
+		slack = atomic_load_explicit(&philo->min_slack, memory_order_relaxed);
+		if (slack < data->publisher.shm->min_slack)
+			data->publisher.shm->min_slack = slack;
+	}
+}
+
+/**
+ * @function sample_monitors
+ * @brief Relève l'état des moniteurs dans l'instantané.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Copie le jeton d'arrêt, additionne les philosophes
+ * encore surveillés et retient la plus proche des échéances publiées
+ * par watch_deadlines.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Une tranche sans philosophe surveillé n'a pas
+ * d'échéance : next_deadline reste à 0 si aucune tranche ne veille.
+ *
+ * @examples sample_monitors(data);
+ *
+ * @dependencies Dépend de atomic_load_explicit.
+ *
+ * @control_flow 1. Jeton d'arrêt.
+ *               2. Somme des tranches et échéance minimale.
+ */
+void	sample_monitors(t_data *data)
+{
+	t_metrics	*shm;
+	long		deadline;
+	int			watched;
+	int			k;
+
+	shm = data->publisher.shm;
+	shm->stop = atomic_load_explicit(&data->someone_died,
+			memory_order_relaxed);
+	shm->watched = 0;
+	shm->next_deadline = 0;
+	k = 0;
+	while (k < data->opts.n_monitors)
+	{
+		watched = atomic_load_explicit(&data->monitors[k].watched,
+				memory_order_relaxed);
+		deadline = atomic_load_explicit(&data->monitors[k++].next_deadline,
+				memory_order_relaxed);
+		shm->watched += watched;
+		if (watched && (!shm->next_deadline || deadline < shm->next_deadline))
+			shm->next_deadline = deadline;
+	}
+}
+
+/**
+ * @function update_meal_rate
+ * @brief Met à jour le débit en repas par seconde de l'instantané.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param now: Temps de l'instantané depuis t0, en microsecondes.
+ *
+ * @description Sur 100 ms, un repas de t_eat tombe ou non dans la
+ * fenêtre : le débit sauterait de 0 à une rafale. Il est donc mesuré
+ * sur au moins t_eat + t_sleep, un cycle de repas, et au moins une
+ * seconde, puis garde sa valeur jusqu'à la mesure suivante.
+ *
+ * @return void
+ *
+ * @errors/edge_effects 0 tant que la première fenêtre n'est pas
+ * écoulée.
+ *
+ * @examples update_meal_rate(data, now);
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Largeur de la fenêtre, au moins METRICS_RATE_US.
+ *               2. Rien tant qu'elle n'est pas écoulée.
+ *               3. Débit sur la fenêtre, puis nouveau point de départ.
+ */
+void	update_meal_rate(t_data *data, long now)
+{
+	t_publisher	*pub;
+	long		window;
+
+	pub = &data->publisher;
+	window = data->global_rules.t_eat + data->global_rules.t_sleep;
+	if (window < METRICS_RATE_US)
+		window = METRICS_RATE_US;
+	if (now - pub->at < window)
+		return ;
+	pub->shm->meals_per_sec = (pub->shm->meals - pub->meals)
+		* SEC_TO_US / (now - pub->at);
+	pub->meals = pub->shm->meals;
+	pub->at = now;
+}
+
+/**
+ * @function publish_metrics
+ * @brief Écrit un instantané sous la protection du seqlock.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Seul écrivain du segment. seq devient impair avant
+ * l'écriture et pair après : un lecteur qui lit deux fois la même
+ * valeur paire autour de sa copie a une copie cohérente, sinon il
+ * recommence.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun verrou : ni les philosophes ni les
+ * lecteurs ne peuvent bloquer l'éditeur, ni être bloqués par lui.
+ *
+ * @examples publish_metrics(data);
+ *
+ * @dependencies Dépend de get_time, sample_philos, sample_monitors et
+ * update_meal_rate.
+ *
+ * @control_flow 1. Ouvrir l'écriture : seq impair, barrière release.
+ *               2. Relever philosophes, moniteurs et débit.
+ *               3. Fermer l'écriture : seq pair en release.
+ */
+void	publish_metrics(t_data *data)
+{
+	t_metrics		*shm;
+	unsigned long	seq;
+	long			now;
+
+	shm = data->publisher.shm;
+	seq = atomic_load_explicit(&shm->seq, memory_order_relaxed);
+	atomic_store_explicit(&shm->seq, seq + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	now = get_time(data->t0);
+	shm->now = now;
+	shm->meals = 0;
+	shm->fork_wait = 0;
+	shm->min_slack = LONG_MAX;
+	sample_philos(data, now);
+	sample_monitors(data);
+	update_meal_rate(data, now);
+	atomic_store_explicit(&shm->seq, seq + 2, memory_order_release);
+}
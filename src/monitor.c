@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   monitor.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:31 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:31 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function parse_monitors
+ * @brief Lit la valeur de --monitors=N.
+ *
+ * @param value: Texte après le '='.
+ * @param opts: Pointeur vers les options.
+ *
+ * @description N est un entier strictement positif ; 1 garde un seul
+ * moniteur, sur le thread principal.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples parse_monitors("4", &opts);
+ *
+ * @dependencies Dépend de is_valid_number et ft_atoi.
+ *
+ * @control_flow 1. Vérifier puis convertir.
+ */
+int	parse_monitors(const char *value, t_options *opts)
+{
+	if (is_valid_number(value, 0) || ft_atoi(value) <= 0)
+		return (FAILURE);
+	opts->n_monitors = ft_atoi(value);
+	return (SUCCESS);
+}
+
+/**
+ * @function split_monitors
+ * @brief Découpe la table en tranches contiguës, une par moniteur.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Le moniteur k reçoit les philosophes
+ * [n * k / N, n * (k + 1) / N) et la portion correspondante de
+ * data->deadlines comme stockage de son tas : les tranches ne se
+ * recouvrent pas, aucun moniteur ne touche les nœuds d'un autre.
+ * L'état publié pour --metrics part de zéro : une tranche reste vide
+ * tant que son moniteur n'a pas construit son tas.
+ *
+ * @return void
+ *
+ * @errors/edge_effects N ne dépasse pas n (borné par arena_map) : aucune
+ * tranche n'est vide.
+ *
+ * @examples split_monitors(data_ptr);
+ *
+ * @dependencies Aucune dépendance externe.
+ *
+ * @control_flow 1. Calculer les bornes de chaque tranche.
+ *               2. Pointer chaque tas sur sa portion de nœuds.
+ */
+void	split_monitors(t_data *data)
+{
+	long	n;
+	long	first;
+	long	last;
+	int		k;
+
+	n = data->global_rules.n_philo;
+	k = 0;
+	while (k < data->opts.n_monitors)
+	{
+		first = n * k / data->opts.n_monitors;
+		last = n * (k + 1) / data->opts.n_monitors;
+		data->monitors[k].data = data;
+		data->monitors[k].heap.nodes = data->deadlines.nodes + first;
+		data->monitors[k].heap.size = last - first;
+		atomic_init(&data->monitors[k].next_deadline, 0);
+		atomic_init(&data->monitors[k].watched, 0);
+		k++;
+	}
+}
+
+/**
+ * @function run_monitor
+ * @brief Corps d'un moniteur : construit son tas puis surveille.
+ *
+ * @param valise: Pointeur vers le t_monitor de la tranche.
+ *
+ * @description Chaque moniteur construit lui-même le tas de sa
+ * tranche : la lecture initiale des last_meal se fait en parallèle.
+ * L'index du premier philosophe se déduit de la position des nœuds
+ * dans data->deadlines.
+ *
+ * @return void*: Toujours NULL.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples pthread_create(&shard->thread, NULL, run_monitor, shard);
+ *
+ * @dependencies Dépend de deadline_heap_build et watch_deadlines.
+ *
+ * @control_flow 1. Construire le tas de la tranche.
+ *               2. Surveiller jusqu'à une mort ou un tas vide.
+ */
+void	*run_monitor(void *valise)
+{
+	t_monitor	*shard;
+
+	shard = valise;
+	deadline_heap_build(shard->data, &shard->heap,
+		shard->heap.nodes - shard->data->deadlines.nodes);
+	watch_deadlines(shard);
+	return (NULL);
+}
+
+/**
+ * @function check_philosopher_life
+ * @brief Vérifie l'état de vie des philosophes.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Lance un thread par tranche sauf la dernière, que le
+ * thread principal surveille lui-même : avec --monitors=1, rien n'est
+ * créé. Les moniteurs partagent someone_died comme drapeau d'arrêt et
+ * un seul d'entre eux imprime "died".
+ *
+ * @return void
+ *
+ * @errors/edge_effects Si un thread ne peut être créé, le thread
+ * principal reprend toutes les tranches restantes en une seule :
+ * chaque philosophe reste surveillé.
+ *
+ * @examples check_philosopher_life(data_ptr);
+ *
+ * @dependencies Dépend de split_monitors, run_monitor, pthread_create
+ * et pthread_join.
+ *
+ * @control_flow 1. Découper la table.
+ *               2. Lancer les moniteurs, jusqu'au premier échec.
+ *               3. Surveiller le reste sur le thread principal.
+ *               4. Rejoindre les moniteurs.
+ */
+void	check_philosopher_life(t_data *data)
+{
+	t_monitor	*last;
+	int			k;
+
+	split_monitors(data);
+	k = 0;
+	while (k < data->opts.n_monitors - 1
+		&& !pthread_create(&data->monitors[k].thread, NULL, run_monitor,
+			&data->monitors[k]))
+		k++;
+	last = &data->monitors[k];
+	last->heap.size = data->global_rules.n_philo
+		- (last->heap.nodes - data->deadlines.nodes);
+	run_monitor(last);
+	while (k-- > 0)
+		pthread_join(data->monitors[k].thread, NULL);
+}
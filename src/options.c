@@ -0,0 +1,242 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:26:40 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 13:26:40 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        init_options
+ * @brief           Initialise les options à leurs valeurs par défaut.
+ * @param t_options *opts - Pointeur vers les options.
+ * 
+ * @description     Mode un thread par philosophe dans un seul processus,
+ *                  un ouvrier par cœur en ligne pour le mode tâches, pas
+ *                  de statistiques, et une simulation sans horizon de
+ *                  graine SIM_DEFAULT_SEED.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         init_options(&data.opts);
+ * 
+ * @dependencies    sysconf
+ * 
+ * @control_flow    1. Affectation des valeurs par défaut.
+ */
+void	init_options(t_options *opts)
+{
+	opts->mode = MODE_THREADS;
+	opts->n_workers = sysconf(_SC_NPROCESSORS_ONLN);
+	if (opts->n_workers < 1)
+		opts->n_workers = 1;
+	opts->stats = 0;
+	opts->seed = SIM_DEFAULT_SEED;
+	opts->until = SIM_NO_HORIZON;
+	opts->strategy = STRATEGY_ODDEVEN;
+	opts->lock = LOCK_PTHREAD;
+	opts->schedule = SCHEDULE_STATIC;
+	opts->n_procs = 1;
+	opts->affinity = 0;
+	opts->stack_size = STACK_DEFAULT_KB * KB_TO_BYTES;
+	opts->hugepages = 0;
+	opts->trace = NULL;
+	opts->n_monitors = 1;
+	opts->metrics = 0;
+}
+
+/**
+ * @function        option_value
+ * @brief           Reconnaît une option et renvoie sa valeur.
+ * @param const     char *arg - L'argument à analyser.
+ * @param const     char *name - Le nom de l'option, '=' compris s'il y a
+ *                  une valeur.
+ * 
+ * @description     Compare le début de l'argument au nom de l'option.
+ * 
+ * @return          Pointeur vers la valeur (chaîne vide sans valeur), ou
+ *                  NULL si l'argument n'est pas cette option.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         value = option_value("--workers=4", OPT_WORKERS);
+ * 
+ * @dependencies    strlen, strncmp
+ * 
+ * @control_flow    1. Comparaison du préfixe.
+ *                  2. Sans '=', l'argument doit être exactement le nom.
+ */
+const char	*option_value(const char *arg, const char *name)
+{
+	size_t	len;
+
+	len = strlen(name);
+	if (strncmp(arg, name, len))
+		return (NULL);
+	if (name[len - 1] != '=' && arg[len])
+		return (NULL);
+	return (arg + len);
+}
+
+/**
+ * @function        parse_value_option
+ * @brief           Applique une option qui porte une valeur.
+ * @param const     char *arg - L'option, préfixe "--" compris.
+ * @param t_options *opts - Pointeur vers les options.
+ * 
+ * @description     --workers=N attend un entier strictement positif,
+ *                  --seed=N un entier, --until=T une durée en
+ *                  millisecondes comme les arguments positionnels. Les
+ *                  options à nom passent par leur propre parseur.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE si l'option est inconnue
+ *                  ou sa valeur invalide.
+ * 
+ * @side_effect     Modification des options.
+ * 
+ * @example         parse_value_option("--workers=4", &opts);
+ * 
+ * @dependencies    option_value, is_valid_number, ft_atoi, ft_atol,
+ *                  ft_atous, parse_strategy, parse_fork_lock,
+ *                  parse_schedule, parse_processes, parse_stack_size
+ * 
+ * @control_flow    1. Recherche de l'option.
+ *                  2. Vérification et conversion de sa valeur.
+ */
+int	parse_value_option(const char *arg, t_options *opts)
+{
+	const char	*value;
+
+	value = option_value(arg, OPT_WORKERS);
+	if (value && !is_valid_number(value, 0) && ft_atoi(value) > 0)
+		opts->n_workers = ft_atoi(value);
+	else if (option_value(arg, OPT_PROCESSES))
+		return (parse_processes(option_value(arg, OPT_PROCESSES), opts));
+	else if (option_value(arg, OPT_STACK_SIZE))
+		return (parse_stack_size(option_value(arg, OPT_STACK_SIZE), opts));
+	else if (option_value(arg, OPT_SEED)
+		&& !is_valid_number(option_value(arg, OPT_SEED), 0))
+		opts->seed = ft_atol(option_value(arg, OPT_SEED));
+	else if (option_value(arg, OPT_UNTIL)
+		&& !is_valid_number(option_value(arg, OPT_UNTIL), 1))
+		opts->until = ft_atous(option_value(arg, OPT_UNTIL));
+	else if (option_value(arg, OPT_STRATEGY))
+		return (parse_strategy(option_value(arg, OPT_STRATEGY), opts));
+	else if (option_value(arg, OPT_LOCK))
+		return (parse_fork_lock(option_value(arg, OPT_LOCK), opts));
+	else if (option_value(arg, OPT_SCHEDULE))
+		return (parse_schedule(option_value(arg, OPT_SCHEDULE), opts));
+	else
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @function        parse_option
+ * @brief           Applique une option de la ligne de commande.
+ * @param const     char *arg - L'option, préfixe "--" compris.
+ * @param t_options *opts - Pointeur vers les options.
+ * 
+ * @description     Reconnaît --tasks, --simulate, --stats, --affinity,
+ *                  --hugepages, --metrics, le chemin non vide de --trace= et
+ *                  --monitors=, puis les autres options à valeur.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE si l'option est inconnue
+ *                  ou sa valeur invalide.
+ * 
+ * @side_effect     Modification des options.
+ * 
+ * @example         if (parse_option("--tasks", &opts))
+ * 
+ * @dependencies    option_value, parse_monitors, parse_value_option
+ * 
+ * @control_flow    1. Recherche des options sans valeur.
+ *                  2. Sinon, options à valeur.
+ */
+int	parse_option(const char *arg, t_options *opts)
+{
+	if (option_value(arg, OPT_TASKS))
+		opts->mode = MODE_TASKS;
+	else if (option_value(arg, OPT_SIMULATE))
+		opts->mode = MODE_SIMULATE;
+	else if (option_value(arg, OPT_STATS))
+		opts->stats = 1;
+	else if (option_value(arg, OPT_AFFINITY))
+		opts->affinity = 1;
+	else if (option_value(arg, OPT_HUGEPAGES))
+		opts->hugepages = 1;
+	else if (option_value(arg, OPT_METRICS))
+		opts->metrics = 1;
+	else if (option_value(arg, OPT_TRACE) && *option_value(arg, OPT_TRACE))
+		opts->trace = option_value(arg, OPT_TRACE);
+	else if (option_value(arg, OPT_MONITORS))
+		return (parse_monitors(option_value(arg, OPT_MONITORS), opts));
+	else
+		return (parse_value_option(arg, opts));
+	return (SUCCESS);
+}
+
+/**
+ * @function        parse_options
+ * @brief           Extrait les options "--" de la ligne de commande.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - Tableau des arguments.
+ * @param t_options *opts - Pointeur vers les options.
+ * 
+ * @description     Les options peuvent apparaître n'importe où. Elles sont
+ *                  retirées de argv, qui ne garde que les arguments
+ *                  positionnels suivis de NULL, comme attendu par check_arg.
+ *                  Les stratégies waiter et chandy et --schedule=hunger
+ *                  n'existent qu'en mode threads, --processes aussi, et
+ *                  sans waiter ni verrou MCS, dont l'état n'est pas
+ *                  partagé entre processus.
+ * 
+ * @return          Le nouveau nombre d'arguments, ou -1 si une option est
+ *                  invalide.
+ * 
+ * @side_effect     Réécriture de argv.
+ * 
+ * @example         argc = parse_options(argc, argv, &data.opts);
+ * 
+ * @dependencies    init_options, parse_option
+ * 
+ * @control_flow    1. Valeurs par défaut.
+ *                  2. Application des options et compactage des arguments.
+ *                  3. Terminaison de argv par NULL.
+ */
+int	parse_options(int argc, char **argv, t_options *opts)
+{
+	int	i;
+	int	kept;
+
+	init_options(opts);
+	i = 1;
+	kept = 1;
+	while (i < argc)
+	{
+		if (!strncmp(argv[i], OPT_PREFIX, strlen(OPT_PREFIX)))
+		{
+			if (parse_option(argv[i], opts))
+				return (-1);
+		}
+		else
+			argv[kept++] = argv[i];
+		i++;
+	}
+	argv[kept] = NULL;
+	if (opts->mode != MODE_THREADS && (opts->strategy >= STRATEGY_WAITER
+			|| opts->schedule == SCHEDULE_HUNGER))
+		return (-1);
+	if (opts->n_procs > 1 && (opts->mode != MODE_THREADS
+			|| opts->strategy == STRATEGY_WAITER || opts->lock == LOCK_MCS))
+		return (-1);
+	return (kept);
+}
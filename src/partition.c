@@ -0,0 +1,231 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   partition.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:31:52 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 20:31:52 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function parse_processes
+ * @brief Lit la valeur de --processes=N.
+ *
+ * @param value: Texte après le '='.
+ * @param opts: Pointeur vers les options.
+ *
+ * @description N est un entier strictement positif ; 1 garde un seul
+ * processus.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples parse_processes("4", &opts);
+ *
+ * @dependencies Dépend de is_valid_number et ft_atoi.
+ *
+ * @control_flow 1. Vérifier puis convertir.
+ */
+int	parse_processes(const char *value, t_options *opts)
+{
+	if (is_valid_number(value, 0) || ft_atoi(value) <= 0)
+		return (FAILURE);
+	opts->n_procs = ft_atoi(value);
+	return (SUCCESS);
+}
+
+/**
+ * @function run_partition
+ * @brief Corps d'un processus ouvrier de --processes.
+ *
+ * @param data: Pointeur vers la structure t_data, dans le segment partagé.
+ * @param index: Rang de la partition.
+ *
+ * @description La partition index reçoit les philosophes contigus
+ * [n * index / N, n * (index + 1) / N[ : seules les deux fourchettes
+ * de bord sont touchées par une autre partition. Un thread par
+ * philosophe, comme en mode threads. Le processus meurt avec le
+ * coordinateur (PR_SET_PDEATHSIG) et sort par _exit pour ne pas vider
+ * le tampon stdout hérité.
+ *
+ * @return void: Ne revient pas.
+ *
+ * @errors/edge_effects Code de sortie FAILURE_CREAT_THREADS ou
+ * FAILURE_JOIN_THREADS en cas d'échec.
+ *
+ * @examples if (pid == 0) run_partition(data, i);
+ *
+ * @dependencies Dépend de prctl, create_philosopher_range, pthread_join
+ * et _exit.
+ *
+ * @control_flow 1. Calculer les bornes de la partition.
+ *               2. Créer puis rejoindre ses threads.
+ *               3. Sortir.
+ */
+void	run_partition(t_data *data, int index)
+{
+	int	first;
+	int	last;
+
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+	first = (long)data->global_rules.n_philo * index / data->opts.n_procs;
+	last = (long)data->global_rules.n_philo * (index + 1)
+		/ data->opts.n_procs;
+	if (create_philosopher_range(data, first, last))
+		_exit(FAILURE_CREAT_THREADS);
+	while (first < last)
+	{
+		if (pthread_join(data->thread_ids[first++], NULL))
+			_exit(FAILURE_JOIN_THREADS);
+	}
+	_exit(SUCCESS);
+}
+
+/**
+ * @function start_partitions
+ * @brief Lance un processus ouvrier par partition.
+ *
+ * @param data: Pointeur vers la structure t_data, dans le segment partagé.
+ *
+ * @description stdout est vidé avant fork() pour qu'aucun ouvrier n'en
+ * hérite d'un tampon plein. Le processus courant reste coordinateur :
+ * moniteur de mort et vidage du journal.
+ *
+ * @return int: SUCCESS ou FAILURE_CREAT_THREADS.
+ *
+ * @errors/edge_effects Les ouvriers déjà lancés meurent avec le
+ * coordinateur si celui-ci abandonne.
+ *
+ * @examples error = start_partitions(data);
+ *
+ * @dependencies Dépend de malloc, fflush, fork et run_partition.
+ *
+ * @control_flow 1. Allouer la table des pid.
+ *               2. Lancer les ouvriers.
+ */
+int	start_partitions(t_data *data)
+{
+	pid_t	pid;
+	int		i;
+
+	data->workers = malloc(sizeof(pid_t) * data->opts.n_procs);
+	if (!data->workers)
+		return (FAILURE_CREAT_THREADS);
+	fflush(stdout);
+	i = 0;
+	while (i < data->opts.n_procs)
+	{
+		pid = fork();
+		if (pid < 0)
+			return (FAILURE_CREAT_THREADS);
+		if (pid == 0)
+			run_partition(data, i);
+		data->workers[i++] = pid;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function reap_partition
+ * @brief Attend la fin d'un processus ouvrier.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param index: Rang de la partition.
+ * @param deadline: Date absolue, en µs, au-delà de laquelle l'ouvrier
+ * est tué.
+ *
+ * @description Un ouvrier mort en tenant une fourchette de bord peut
+ * bloquer son voisin pour toujours : passé le délai, il est tué. Une
+ * fin par signal est rapportée sur stderr avec les philosophes
+ * concernés ; le moniteur, lui, a déjà vu leur mort de faim.
+ *
+ * @return int: SUCCESS, le code d'échec de l'ouvrier, ou
+ * FAILURE_JOIN_THREADS si waitpid échoue.
+ *
+ * @errors/edge_effects Une attente interrompue (EINTR) est reprise.
+ * Toute autre erreur de waitpid (ECHILD) laisse status indéfini : il
+ * n'est pas décodé.
+ *
+ * @examples error = reap_partition(data, i, deadline);
+ *
+ * @dependencies Dépend de waitpid, kill, usleep et get_time.
+ *
+ * @control_flow 1. Attendre l'ouvrier jusqu'au délai.
+ *               2. Le tuer au-delà, et attendre sa fin.
+ *               3. Sur échec de waitpid, s'arrêter sans décoder status.
+ *               4. Rapporter sa fin.
+ */
+int	reap_partition(t_data *data, int index, long deadline)
+{
+	int		status;
+	pid_t	reaped;
+	int		n;
+
+	reaped = waitpid(data->workers[index], &status, WNOHANG);
+	while (reaped == 0 || (reaped < 0 && errno == EINTR))
+	{
+		if (get_time(0) >= deadline)
+			kill(data->workers[index], SIGKILL);
+		usleep(PARTITION_POLL_US);
+		reaped = waitpid(data->workers[index], &status, WNOHANG);
+	}
+	if (reaped < 0)
+		return (FAILURE_JOIN_THREADS);
+	n = data->global_rules.n_philo;
+	if (WIFSIGNALED(status))
+		fprintf(stderr, PARTITION_SIGNALED, index,
+			(int)((long)n * index / data->opts.n_procs) + 1,
+			(int)((long)n * (index + 1) / data->opts.n_procs),
+			WTERMSIG(status));
+	else if (WIFEXITED(status) && WEXITSTATUS(status))
+		return (WEXITSTATUS(status));
+	return (SUCCESS);
+}
+
+/**
+ * @function join_partitions
+ * @brief Attend tous les processus ouvriers.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Appelé après le moniteur : chaque ouvrier a
+ * PARTITION_GRACE_US pour voir la fin de la simulation et rejoindre
+ * ses threads.
+ *
+ * @return int: SUCCESS ou le premier code d'échec.
+ *
+ * @errors/edge_effects Tous les ouvriers sont attendus, même après un
+ * échec.
+ *
+ * @examples error = join_partitions(data);
+ *
+ * @dependencies Dépend de reap_partition et get_time.
+ *
+ * @control_flow 1. Fixer le délai.
+ *               2. Attendre chaque ouvrier.
+ */
+int	join_partitions(t_data *data)
+{
+	long	deadline;
+	int		error;
+	int		code;
+	int		i;
+
+	deadline = get_time(0) + PARTITION_GRACE_US;
+	error = SUCCESS;
+	i = 0;
+	while (i < data->opts.n_procs)
+	{
+		code = reap_partition(data, i, deadline);
+		if (code && !error)
+			error = code;
+		i++;
+	}
+	return (error);
+}
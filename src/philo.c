@@ -17,8 +17,15 @@
  * @brief           Initialise et lance les threads de philosophes.
  * @param t_data    *data - Pointeur vers les données partagées.
  * 
- * @description     Initialise le temps de départ et crée les threads pour
- *                  chaque philosophe. Rejoint ensuite ces threads.
+ * @description     Initialise le temps de départ, lance le thread de vidage
+ *                  du journal puis les philosophes : un thread chacun,
+ *                  des tâches réparties sur les ouvriers avec --tasks, ou
+ *                  des processus ouvriers avec --processes, dont ce
+ *                  processus devient le coordinateur. Avec --simulate,
+ *                  tout se joue en temps virtuel sur le thread principal.
+ *                  Avec --metrics, un éditeur publie l'état de la table
+ *                  tant que les moniteurs veillent. Rejoint ensuite ces
+ *                  threads puis arrête le journal.
  * 
  * @return          Retourne SUCCESS ou les codes d'échec.
  * 
@@ -26,35 +33,85 @@
  * 
  * @example         if (initialize_and_start(&data) != SUCCESS)
  * 
- * @dependencies    get_time, pthread_create, pthread_join, 
- *                  check_philosopher_life
+ * @dependencies    calibrate_sleep_tail, get_time, check_philosopher_life,
+ *                  start_philosophers, join_philosophers,
+ *                  run_simulation, log_start, log_stop, metrics_start,
+ *                  metrics_stop
  * 
- * @control_flow    1. Initialisation du temps de départ.
- *                  2. Création des threads.
+ * @control_flow    1. Calibrage du sommeil et temps de départ.
+ *                  2. Démarrage du journal et des philosophes.
  *                  3. Vérification de la vie des philosophes.
- *                  4. Jointure des threads.
+ *                  4. Jointure, mesure de la durée et arrêt du journal.
  */
 int	initialize_and_start(t_data *data)
 {
-	int	i;
+	int	error;
 
-	i = 0;
+	if (data->opts.mode == MODE_SIMULATE)
+		return (run_simulation(data));
+	calibrate_sleep_tail(data);
 	data->t0 = get_time(0);
-	while (i < data->global_rules.n_philo)
-	{
-		if (pthread_create(&data->thread_ids[i], NULL,
-				&run_philosopher_routine, &data->philo[i]))
-			return (FAILURE_CREAT_THREADS);
-		i++;
-	}
+	if (log_start(&data->log))
+		return (FAILURE_CREAT_THREADS);
+	affinity_pin(data, data->log.flusher, AFFINITY_FLUSHER, 0);
+	error = start_philosophers(data);
+	if (error)
+		return (error);
+	open_start_gate(data);
+	metrics_start(data);
+	affinity_pin(data, pthread_self(), AFFINITY_MONITOR, 0);
 	check_philosopher_life(data);
+	metrics_stop(data);
+	error = join_philosophers(data);
+	if (error)
+		return (error);
+	data->t_end = get_time(data->t0);
+	return (log_stop(&data->log));
+}
+
+/**
+ * @function        is_valid_number
+ * @brief           Vérifie qu'un argument est un entier positif bien formé.
+ * @param const     char *arg - L'argument à vérifier.
+ * @param int       allow_fraction - Accepte une partie décimale si non nul.
+ * 
+ * @description     L'argument doit être composé de chiffres et ne pas
+ *                  dépasser IMAX. Pour les durées, une partie décimale d'au
+ *                  plus MAX_FRACTION_DIGITS chiffres est acceptée, ce qui
+ *                  permet des durées à la microseconde près.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         if (is_valid_number("200.5", 1) != SUCCESS)
+ * 
+ * @dependencies    ft_atol
+ * 
+ * @control_flow    1. Vérification de la partie entière.
+ *                  2. Vérification de la partie décimale éventuelle.
+ *                  3. Vérification de la limite IMAX.
+ */
+int	is_valid_number(const char *arg, int allow_fraction)
+{
+	int	i;
+	int	fraction;
+
 	i = 0;
-	while (i < data->global_rules.n_philo)
-	{
-		if (pthread_join(data->thread_ids[i], NULL))
-			return (FAILURE_JOIN_THREADS);
+	while (arg[i] >= '0' && arg[i] <= '9')
 		i++;
+	if (!i)
+		return (FAILURE);
+	if (arg[i] == '.' && allow_fraction)
+	{
+		fraction = 0;
+		while (arg[++i] >= '0' && arg[i] <= '9')
+			fraction++;
+		if (!fraction || fraction > MAX_FRACTION_DIGITS)
+			return (FAILURE);
 	}
+	if (arg[i] || ft_atol(arg) > IMAX)
+		return (FAILURE);
 	return (SUCCESS);
 }
 
@@ -66,6 +123,7 @@ int	initialize_and_start(t_data *data)
  * 
  * @description     Vérifie le nombre d'arguments et leurs valeurs pour s'assurer
  *                  qu'ils sont valides selon les contraintes du programme.
+ *                  Les trois durées acceptent une partie décimale en ms.
  * 
  * @return          Retourne SUCCESS ou FAILURE.
  * 
@@ -73,11 +131,11 @@ int	initialize_and_start(t_data *data)
  * 
  * @example         if (check_arg(argc, argv) != SUCCESS)
  * 
- * @dependencies    ft_atoi, ft_atol
+ * @dependencies    is_valid_number, ft_atoi, ft_atous
  * 
  * @control_flow    1. Vérification du nombre d'arguments.
- *                  2. Vérification des limites des arguments.
- *                  3. Vérification des types des arguments.
+ *                  2. Vérification du format de chaque argument.
+ *                  3. Vérification des valeurs strictement positives.
  */
 int	check_arg(int argc, char **argv)
 {
@@ -85,28 +143,48 @@ int	check_arg(int argc, char **argv)
 
 	if (argc < 5 || argc > 6)
 		return (FAILURE);
-	if (ft_atol(argv[1]) > IMAX || ft_atol(argv[2]) > IMAX
-		|| ft_atol(argv[3]) > IMAX || ft_atol(argv[4]) > IMAX
-		|| (argv[5] && ft_atol(argv[5]) > IMAX))
-		return (FAILURE);
-	if (ft_atoi(argv[1]) <= 0 || ft_atoi(argv[2]) <= 0
-		|| ft_atoi(argv[3]) <= 0 || ft_atoi(argv[4]) <= 0
-		|| (argv[1] && ft_atoi(argv[1]) <= 0))
-		return (FAILURE);
-	while (argc > 1)
+	i = 1;
+	while (i < argc)
 	{
-		i = 0;
-		while (argv[argc - 1][i])
-		{
-			if (!(argv[argc - 1][i] >= '0' && argv[argc - 1][i] <= '9'))
-				return (FAILURE);
-			i++;
-		}
-		argc--;
+		if (is_valid_number(argv[i], i >= ARG_T_DIE && i <= ARG_T_SLEEP))
+			return (FAILURE);
+		i++;
 	}
+	if (ft_atoi(argv[1]) <= 0 || ft_atous(argv[2]) <= 0
+		|| ft_atous(argv[3]) <= 0 || ft_atous(argv[4]) <= 0)
+		return (FAILURE);
 	return (SUCCESS);
 }
 
+/**
+ * @function        print_reports
+ * @brief           Imprime les bilans demandés une fois la course finie.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     --stats, et selon la compilation les histogrammes
+ *                  (PHILO_HISTO) et le profil des verrous (PHILO_PROFILE),
+ *                  tous sur stderr.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stderr.
+ * 
+ * @example         print_reports(data);
+ * 
+ * @dependencies    print_stats, print_histograms, print_profile
+ * 
+ * @control_flow    1. Statistiques, histogrammes puis profil.
+ */
+void	print_reports(t_data *data)
+{
+	if (data->opts.stats)
+		print_stats(data);
+	if (HISTO_ENABLED)
+		print_histograms(data);
+	if (PROFILE_ENABLED)
+		print_profile(data);
+}
+
 /**
  * @function        main
  * @brief           Point d'entrée principal du programme.
@@ -115,6 +193,11 @@ int	check_arg(int argc, char **argv)
  * 
  * @description     Initialise les données, les vérifie et gère le flux du 
  *                  programme de la création à la fin des threads.
+ *                  local est mis à zéro : les champs que seule une
+ *                  option remplit (publisher sans --metrics) sont
+ *                  nuls. arena_map projette l'arène de la table avant
+ *                  l'initialisation ; avec --processes, les données y
+ *                  sont copiées.
  * 
  * @return          Retourne SUCCESS ou les codes d'erreur.
  * 
@@ -122,32 +205,35 @@ int	check_arg(int argc, char **argv)
  * 
  * @example         ./executable <args>
  * 
- * @dependencies    check_arg, init, initialize_and_start, cleanup_and_end
+ * @dependencies    parse_options, check_arg, arena_map, init,
+ *                  initialize_and_start, print_reports, cleanup_and_end
  * 
- * @control_flow    1. Vérification des arguments.
+ * @control_flow    1. Lecture des options et vérification des arguments.
  *                  2. Initialisation des données.
  *                  3. Création et gestion des threads.
  *                  4. Nettoyage et terminaison.
  */
 int	main(int argc, char **argv)
 {
-	t_data	data;
+	t_data	local;
+	t_data	*data;
 	int		error;
 
-	data.someone_died = 0;
-	if (check_arg(argc, argv))
+	memset(&local, 0, sizeof(t_data));
+	atomic_init(&local.someone_died, NO_ONE_DIED);
+	argc = parse_options(argc, argv, &local.opts);
+	if (argc < 0 || check_arg(argc, argv))
 		return (printf(ERR_ARGS));
-	error = 0;
-	error = init(&data, argv);
-	if (error)
+	data = arena_map(&local, ft_atoi(argv[1]));
+	if (!data || init(data, argv))
 		return (printf(ERR_ALLOC));
-	error = initialize_and_start(&data);
+	error = initialize_and_start(data);
 	if (error == FAILURE_CREAT_THREADS)
 		return (printf(ERR_CREAT_THREADS));
 	if (error == FAILURE_JOIN_THREADS)
 		return (printf(ERR_JOIN_THREADS));
-	error = cleanup_and_end(&data);
-	if (error)
+	print_reports(data);
+	if (cleanup_and_end(data))
 		return (printf(ERR_MUTEX_OPEN));
 	return (SUCCESS);
 }
@@ -63,65 +63,56 @@ int	ft_atoi(const char *nptr)
 /**
  * @function        get_time
  * @brief           Obtient le temps actuel depuis une origine t0.
- * @param long      t0 - Le temps d'origine en millisecondes.
+ * @param long      t0 - Le temps d'origine en microsecondes.
  * 
- * @description     Utilise gettimeofday pour récupérer le temps actuel, puis le
- *                  convertit en millisecondes et soustrait t0.
+ * @description     Lit CLOCK_MONOTONIC, insensible aux sauts NTP, convertit
+ *                  en microsecondes et soustrait t0. Toute l'horloge interne
+ *                  est en microsecondes ; seul l'affichage passe en ms.
  * 
- * @return          Le temps écoulé depuis t0 en millisecondes.
+ * @return          Le temps écoulé depuis t0 en microsecondes.
  * 
  * @side_effect     Aucun.
  * 
- * @example         long elapsed = get_time(1633045622L);
+ * @example         long elapsed = get_time(data->t0);
  * 
- * @dependencies    gettimeofday
+ * @dependencies    clock_gettime
  * 
- * @control_flow    1. Obtenir le temps actuel via gettimeofday.
- *                  2. Convertir en millisecondes.
+ * @control_flow    1. Obtenir le temps monotone via clock_gettime.
+ *                  2. Convertir en microsecondes.
  *                  3. Soustraire t0.
  */
 long	get_time(long t0)
 {
-	struct timeval	tv;
+	struct timespec	ts;
 
-	gettimeofday(&tv, NULL);
-	return (tv.tv_usec / US_TO_MS + tv.tv_sec * SEC_TO_MS - t0);
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * SEC_TO_US + ts.tv_nsec / US_TO_NS - t0);
 }
 
 /**
- * @function        ft_usleep
- * @brief           Met en pause l'exécution pendant une durée.
+ * @function        table_now
+ * @brief           Horloge de la table : réelle, ou virtuelle avec --simulate.
  * @param t_data    *data - Pointeur vers les données partagées.
- * @param long      duration - Durée de la pause en millisecondes.
  * 
- * @description     Met le thread en pause pendant 'duration' millisecondes,
- *                  tout en vérifiant si le philosophe doit continuer.
+ * @description     Le code partagé avec la simulation (prise des
+ *                  fourchettes, fin du quota) lit l'heure par ici : en
+ *                  simulation, t0 n'est pas fixé et seule sim.now compte.
  * 
- * @return          Aucun.
+ * @return          Le temps écoulé depuis t0, ou le temps virtuel, en µs.
  * 
- * @side_effect     Pause dans l'exécution du thread.
+ * @side_effect     Aucun.
  * 
- * @example         ft_usleep(shared_data, 500);
+ * @example         philo->hungry_at = table_now(philo->shared_data);
  * 
- * @dependencies    get_time, usleep, should_philo_continue
+ * @dependencies    get_time
  * 
- * @control_flow    1. Enregistrement du temps de départ.
- *                  2. Boucle jusqu'à ce que la durée soit écoulée.
- *                  3. Appels de usleep et mise à jour du temps actuel.
+ * @control_flow    1. Temps virtuel en simulation, sinon get_time(t0).
  */
-void	ft_usleep(t_data *data, long duration)
+long	table_now(t_data *data)
 {
-	long	start_t;
-	long	cur_t;
-
-	start_t = get_time(0);
-	cur_t = start_t;
-	while (!should_philo_continue(data, &data->philo[0])
-		&& (cur_t - start_t) < duration)
-	{
-		usleep(100);
-		cur_t = get_time(0);
-	}
+	if (data->opts.mode == MODE_SIMULATE)
+		return (data->sim.now);
+	return (get_time(data->t0));
 }
 
 /**
@@ -135,53 +126,54 @@ void	ft_usleep(t_data *data, long duration)
  * 
  * @return          Retourne SUCCESS ou FAILURE.
  * 
- * @side_effect     Utilisation d'un mutex pour accéder à la ressource partagée.
+ * @side_effect     Aucun verrou : lectures atomiques uniquement. someone_died
+ *                  est lu en acquire pour s'apparier au release du moniteur.
  * 
  * @example         if (should_philo_continue(data, &philo))
  * 
- * @dependencies    pthread_mutex_lock, pthread_mutex_unlock
+ * @dependencies    atomic_load_explicit
  * 
- * @control_flow    1. Verrouillage du mutex.
- *                  2. Vérification des conditions.
- *                  3. Déverrouillage du mutex.
+ * @control_flow    1. Lecture atomique de someone_died.
+ *                  2. Lecture atomique de remaining_meal.
  */
 int	should_philo_continue(t_data *data, t_philo *philo)
 {
-	pthread_mutex_lock(&data->shared_resource_mutex);
-	if (data->someone_died || !philo->remaining_meal)
-	{
-		pthread_mutex_unlock(&data->shared_resource_mutex);
+	if (atomic_load_explicit(&data->someone_died, memory_order_acquire)
+		|| !atomic_load_explicit(&philo->remaining_meal,
+			memory_order_relaxed))
 		return (FAILURE);
-	}
-	pthread_mutex_unlock(&data->shared_resource_mutex);
 	return (SUCCESS);
 }
 
 /**
  * @function        print_meal
- * @brief           Imprime les actions de repas du philosophe.
+ * @brief           Journalise les actions de repas du philosophe.
  * @param t_philo   *philo - Pointeur vers le philosophe concerné.
  * 
- * @description     Imprime les actions du philosophe liées au repas si le 
- *                  philosophe doit continuer à agir.
+ * @description     Journalise les actions du philosophe liées au repas si le 
+ *                  philosophe doit continuer à agir. L'appelant tient le
+ *                  mutex d'écriture.
  * 
  * @return          Aucun.
  * 
- * @side_effect     Impression dans la console.
+ * @side_effect     Dépôt de trois enregistrements dans l'anneau.
  * 
  * @example         print_meal(&philo);
  * 
- * @dependencies    printf, should_philo_continue
+ * @dependencies    log_push, should_philo_continue
  * 
  * @control_flow    1. Vérification de la condition de continuation.
- *                  2. Impressions successives liées au repas.
+ *                  2. Dépôts successifs liés au repas.
  */
 void	print_meal(t_philo *philo)
 {
+	long	last_meal;
+
+	last_meal = atomic_load_explicit(&philo->last_meal, memory_order_relaxed);
 	if (!should_philo_continue(philo->shared_data, philo))
 	{
-		printf(LOG_FORK, philo->last_meal, philo->id);
-		printf(LOG_FORK, philo->last_meal, philo->id);
-		printf(LOG_EAT, philo->last_meal, philo->id);
+		log_push(philo->shared_data, last_meal, philo->id, LOG_EV_FORK);
+		log_push(philo->shared_data, last_meal, philo->id, LOG_EV_FORK);
+		log_push(philo->shared_data, last_meal, philo->id, LOG_EV_EAT);
 	}
 }
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:08:21 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 13:08:21 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function profile_init
+ * @brief Prépare les profils de verrous d'un binaire make profile.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Un profil par fourchette, puis PROFILE_MUTEXES profils
+ * pour les mutex partagés : le mutex d'écriture vient juste après la
+ * dernière fourchette. Les profils sont pris dans l'arène, partagés
+ * avec les processus ouvriers de --processes, et mis à zéro par mmap :
+ * seules les pages d'histogramme réellement touchées sont chargées.
+ *
+ * @return int: SUCCESS, ou FAILURE si l'arène est épuisée.
+ *
+ * @errors/edge_effects Sans PHILO_PROFILE, profiles reste NULL et rien
+ * n'est alloué.
+ *
+ * @examples if (profile_init(data))
+ *
+ * @dependencies Dépend de arena_alloc.
+ *
+ * @control_flow 1. Allouer les profils dans l'arène.
+ */
+int	profile_init(t_data *data)
+{
+	data->profiles = NULL;
+	if (!PROFILE_ENABLED)
+		return (SUCCESS);
+	data->profiles = arena_alloc(data, sizeof(t_lock_profile)
+			* (data->global_rules.n_philo + PROFILE_MUTEXES));
+	if (!data->profiles)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @function profile_now
+ * @brief Horloge du profileur, en nanosecondes.
+ *
+ * @description Une prise libre dure quelques dizaines de nanosecondes :
+ * get_time, à la microseconde, ne distinguerait pas une prise libre
+ * d'une courte attente.
+ *
+ * @return long: CLOCK_MONOTONIC en ns.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples asked_at = profile_now();
+ *
+ * @dependencies Dépend de clock_gettime.
+ *
+ * @control_flow 1. Lire l'horloge.
+ */
+long	profile_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * SEC_TO_NS + ts.tv_nsec);
+}
+
+/**
+ * @function profile_acquired
+ * @brief Compte une prise de verrou et son attente.
+ *
+ * @param profile: Profil du verrou, que l'appelant vient de prendre.
+ * @param asked_at: Instant de la demande, de profile_now.
+ *
+ * @description Une prise est contestée si elle a attendu plus de
+ * PROFILE_CONTENDED_NS, bien au-delà du coût d'une prise libre. Note
+ * l'instant de la prise pour la durée de détention.
+ *
+ * @return void
+ *
+ * @errors/edge_effects held_at n'est écrit que par le détenteur du
+ * verrou : le verrou lui-même ordonne ces écritures.
+ *
+ * @examples profile_acquired(&data->profiles[i], asked_at);
+ *
+ * @dependencies Dépend de profile_now et histo_record.
+ *
+ * @control_flow 1. Mesurer l'attente, compter la prise.
+ *               2. Noter l'instant de la prise.
+ */
+void	profile_acquired(t_lock_profile *profile, long asked_at)
+{
+	long	now;
+
+	now = profile_now();
+	atomic_fetch_add_explicit(&profile->acquired, 1, memory_order_relaxed);
+	if (now - asked_at > PROFILE_CONTENDED_NS)
+		atomic_fetch_add_explicit(&profile->contended, 1,
+			memory_order_relaxed);
+	histo_record(&profile->wait, (now - asked_at) / US_TO_NS);
+	profile->held_at = now;
+}
+
+/**
+ * @function profile_released
+ * @brief Mesure la détention d'un verrou sur le point d'être rendu.
+ *
+ * @param profile: Profil du verrou, encore tenu par l'appelant.
+ *
+ * @description À appeler avant de déverrouiller, tant que held_at
+ * appartient encore à l'appelant.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples profile_released(&data->profiles[i]);
+ *
+ * @dependencies Dépend de profile_now et histo_record.
+ *
+ * @control_flow 1. Enregistrer la durée de détention.
+ */
+void	profile_released(t_lock_profile *profile)
+{
+	histo_record(&profile->hold,
+		(profile_now() - profile->held_at) / US_TO_NS);
+}
@@ -0,0 +1,197 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile_report.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:42:57 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 13:42:57 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        is_hotter
+ * @brief           Compare deux fourchettes pour le classement.
+ * @param t_lock_profile *a - Première fourchette.
+ * @param t_lock_profile *b - Seconde fourchette.
+ * 
+ * @description     Plus de prises contestées d'abord, puis plus de
+ *                  prises.
+ * 
+ * @return          Non nul si a passe avant b.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         if (is_hotter(&p[i], &p[hot[j - 1]]))
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Comparaison.
+ */
+int	is_hotter(t_lock_profile *a, t_lock_profile *b)
+{
+	if (a->contended != b->contended)
+		return (a->contended > b->contended);
+	return (a->acquired > b->acquired);
+}
+
+/**
+ * @function        select_hot_forks
+ * @brief           Retient les fourchettes les plus disputées.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param int       *hot - Reçoit les index, les plus disputées d'abord.
+ * @param int       rows - Nombre de fourchettes voulues.
+ * 
+ * @description     Classe par prises contestées, puis par prises. Tri
+ *                  par insertion dans rows cases, un seul passage sur la
+ *                  table. Une fourchette jamais prise n'est pas retenue.
+ * 
+ * @return          Le nombre d'index retenus, au plus rows.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         count = select_hot_forks(data, hot, PROFILE_ROWS);
+ * 
+ * @dependencies    is_hotter
+ * 
+ * @control_flow    1. Insérer chaque fourchette prise à son rang.
+ */
+int	select_hot_forks(t_data *data, int *hot, int rows)
+{
+	t_lock_profile	*p;
+	int				count;
+	int				i;
+	int				j;
+
+	p = data->profiles;
+	count = 0;
+	i = -1;
+	while (++i < data->global_rules.n_philo)
+	{
+		if (!p[i].acquired)
+			continue ;
+		j = count;
+		if (count < rows)
+			count++;
+		while (j > 0 && is_hotter(&p[i], &p[hot[j - 1]]))
+		{
+			if (j < rows)
+				hot[j] = hot[j - 1];
+			j--;
+		}
+		if (j < rows)
+			hot[j] = i;
+	}
+	return (count);
+}
+
+/**
+ * @function        print_profile_row
+ * @brief           Affiche la ligne d'un verrou.
+ * @param const     char *name - Nom du verrou.
+ * @param t_lock_profile *profile - Son profil.
+ * 
+ * @description     Prises, prises contestées, puis p50, p99 et maximum
+ *                  de l'attente et de la détention, en µs.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stderr.
+ * 
+ * @example         print_profile_row(PROFILE_WRITE, profile);
+ * 
+ * @dependencies    histo_percentile
+ * 
+ * @control_flow    1. Affichage.
+ */
+void	print_profile_row(const char *name, t_lock_profile *profile)
+{
+	fprintf(stderr, PROFILE_ROW, name, profile->acquired,
+		profile->contended, histo_percentile(&profile->wait, HISTO_P50),
+		histo_percentile(&profile->wait, HISTO_P99), profile->wait.max,
+		histo_percentile(&profile->hold, HISTO_P50),
+		histo_percentile(&profile->hold, HISTO_P99), profile->hold.max);
+}
+
+/**
+ * @function        print_fork_totals
+ * @brief           Affiche les totaux de toutes les fourchettes.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param int       shown - Nombre de fourchettes détaillées ensuite.
+ * 
+ * @description     Somme des prises et des prises contestées.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stderr.
+ * 
+ * @example         print_fork_totals(data, count);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Sommer puis afficher.
+ */
+void	print_fork_totals(t_data *data, int shown)
+{
+	unsigned long	acquired;
+	unsigned long	contended;
+	int				i;
+
+	acquired = 0;
+	contended = 0;
+	i = 0;
+	while (i < data->global_rules.n_philo)
+	{
+		acquired += data->profiles[i].acquired;
+		contended += data->profiles[i++].contended;
+	}
+	fprintf(stderr, PROFILE_FORKS, data->global_rules.n_philo, acquired,
+		contended, shown);
+}
+
+/**
+ * @function        print_profile
+ * @brief           Affiche le tableau des verrous d'un binaire make profile.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Le mutex d'écriture, le total des fourchettes, puis
+ *                  les PROFILE_ROWS fourchettes les plus disputées : une
+ *                  table impaire ou le passage de la dernière place à la
+ *                  première ressortent en tête.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stderr.
+ * 
+ * @example         if (PROFILE_ENABLED) print_profile(data);
+ * 
+ * @dependencies    select_hot_forks, print_fork_totals, print_profile_row
+ * 
+ * @control_flow    1. En-tête et mutex d'écriture.
+ *                  2. Totaux des fourchettes.
+ *                  3. Fourchettes les plus disputées.
+ */
+void	print_profile(t_data *data)
+{
+	char	name[PROFILE_NAME_LEN];
+	int		hot[PROFILE_ROWS];
+	int		count;
+	int		i;
+
+	fprintf(stderr, PROFILE_HEADER, "lock", "acquired", "contended",
+		"wait p50", "p99", "max", "hold p50", "p99", "max");
+	print_profile_row(PROFILE_WRITE,
+		&data->profiles[data->global_rules.n_philo]);
+	count = select_hot_forks(data, hot, PROFILE_ROWS);
+	print_fork_totals(data, count);
+	i = 0;
+	while (i < count)
+	{
+		snprintf(name, PROFILE_NAME_LEN, PROFILE_FORK,
+			hot[i] + PHILO_ID_OFFSET);
+		print_profile_row(name, &data->profiles[hot[i++]]);
+	}
+}
@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   schedule.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:05:47 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 20:05:47 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function parse_schedule
+ * @brief Lit la valeur de --schedule=.
+ *
+ * @param name: "static" ou "hunger".
+ * @param opts: Reçoit le mode d'ordonnancement.
+ *
+ * @description static garde le temps de réflexion fixe de init. hunger le
+ * remplace par une attente des voisins plus proches de la mort.
+ *
+ * @return SUCCESS ou FAILURE si le nom est inconnu.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples parse_schedule("hunger", opts);
+ *
+ * @dependencies Dépend de strcmp.
+ *
+ * @control_flow 1. Comparer aux deux noms.
+ */
+int	parse_schedule(const char *name, t_options *opts)
+{
+	if (!strcmp(name, SCHEDULE_STATIC_NAME))
+		opts->schedule = SCHEDULE_STATIC;
+	else if (!strcmp(name, SCHEDULE_HUNGER_NAME))
+		opts->schedule = SCHEDULE_HUNGER;
+	else
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @function philo_outranks
+ * @brief Dit si 'a' doit manger avant 'b'.
+ *
+ * @param a: Premier philosophe.
+ * @param b: Second philosophe.
+ *
+ * @description t_die étant commun, l'échéance la plus proche est celle du
+ * plus ancien dernier repas. À égalité (départ), les impairs passent
+ * avant les pairs, puis le plus petit id : c'est l'ordre de création des
+ * threads, et celui des fourchettes propres de Chandy/Misra. L'ordre est
+ * total : de deux voisins affamés, un seul cède.
+ *
+ * @return 1 si 'a' est prioritaire, 0 sinon.
+ *
+ * @errors/edge_effects Lectures atomiques sans verrou : un repas qui
+ * commence pendant la comparaison ne fait que retarder la décision.
+ *
+ * @examples if (philo_outranks(rival, philo))
+ *
+ * @dependencies Dépend de atomic_load_explicit.
+ *
+ * @control_flow 1. Comparer les derniers repas.
+ *               2. Départager par la parité puis par l'id.
+ */
+int	philo_outranks(t_philo *a, t_philo *b)
+{
+	long	meal_a;
+	long	meal_b;
+
+	meal_a = atomic_load_explicit(&a->last_meal, memory_order_acquire);
+	meal_b = atomic_load_explicit(&b->last_meal, memory_order_acquire);
+	if (meal_a != meal_b)
+		return (meal_a < meal_b);
+	if (a->id % 2 != b->id % 2)
+		return (a->id % 2 == 1);
+	return (a->id < b->id);
+}
+
+/**
+ * @function hungrier_neighbour
+ * @brief Cherche un voisin affamé plus proche de la mort.
+ *
+ * @param philo: Le philosophe qui veut manger.
+ *
+ * @description Un voisin n'est affamé qu'entre yield_to_hungrier et
+ * l'obtention de ses fourchettes : un voisin qui dort ou qui mange ne
+ * retient personne.
+ *
+ * @return Le voisin prioritaire, ou NULL.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples rival = hungrier_neighbour(philo);
+ *
+ * @dependencies Dépend de philo_outranks.
+ *
+ * @control_flow 1. Tester le voisin de gauche puis celui de droite.
+ */
+t_philo	*hungrier_neighbour(t_philo *philo)
+{
+	t_philo	*rival;
+	int		n;
+
+	n = philo->rules->n_philo;
+	rival = &philo->shared_data->philo[(philo->id - 2 + n) % n];
+	if (atomic_load(&rival->hungry) && philo_outranks(rival, philo))
+		return (rival);
+	rival = &philo->shared_data->philo[philo->id % n];
+	if (atomic_load(&rival->hungry) && philo_outranks(rival, philo))
+		return (rival);
+	return (NULL);
+}
+
+/**
+ * @function yield_to_hungrier
+ * @brief Laisse passer les voisins plus affamés avant de prendre les
+ * fourchettes (--schedule=hunger).
+ *
+ * @param philo: Le philosophe qui veut manger.
+ *
+ * @description Remplace le temps de réflexion fixe : le philosophe ne
+ * pense qu'aussi longtemps qu'un voisin plus proche de la mort attend la
+ * fourchette commune, puis tente aussitôt de manger. L'annonce de sa faim
+ * et la lecture de celle des voisins sont séquentiellement cohérentes :
+ * de deux voisins qui arrivent ensemble, chacun voit l'autre. L'attente
+ * se fait sur le mot futex 'hungry' du voisin, bornée par sa propre
+ * échéance.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Abandonne l'attente si quelqu'un meurt ou si sa
+ * propre échéance est atteinte.
+ *
+ * @examples yield_to_hungrier(philo);
+ *
+ * @dependencies Dépend de hungrier_neighbour, futex_wait_until, get_time.
+ *
+ * @control_flow 1. Annoncer sa faim.
+ *               2. Tant qu'un voisin est prioritaire, attendre qu'il ait
+ *                  ses fourchettes.
+ */
+void	yield_to_hungrier(t_philo *philo)
+{
+	t_data	*data;
+	t_philo	*rival;
+	long	deadline;
+
+	data = philo->shared_data;
+	atomic_store(&philo->hungry, HUNGRY);
+	rival = hungrier_neighbour(philo);
+	while (rival && !atomic_load_explicit(&data->someone_died,
+			memory_order_acquire))
+	{
+		deadline = data->t0 + atomic_load_explicit(&philo->last_meal,
+				memory_order_relaxed) + philo->rules->t_die;
+		if (get_time(0) >= deadline)
+			return ;
+		futex_wait_until(&rival->hungry, HUNGRY, deadline);
+		rival = hungrier_neighbour(philo);
+	}
+}
+
+/**
+ * @function clear_hunger
+ * @brief Annonce que le philosophe a ses fourchettes.
+ *
+ * @param philo: Le philosophe qui va manger.
+ *
+ * @description Réveille les voisins qui lui cédaient le passage.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples clear_hunger(philo);
+ *
+ * @dependencies Dépend de futex_wake_all.
+ *
+ * @control_flow 1. Publier FED et réveiller.
+ */
+void	clear_hunger(t_philo *philo)
+{
+	atomic_store(&philo->hungry, FED);
+	futex_wake_all(&philo->hungry);
+}
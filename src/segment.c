@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   segment.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:58:14 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 22:58:14 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function shm_segment
+ * @brief Crée et projette un segment shm_open anonyme.
+ *
+ * @param size: Taille du segment en octets.
+ *
+ * @description Le nom, propre au processus, est délié aussitôt après
+ * mmap : la projection survit, hérite au travers de fork(), et rien ne
+ * traîne dans /dev/shm, même après un crash.
+ *
+ * @return void*: Le segment, mis à zéro par ftruncate, ou MAP_FAILED.
+ *
+ * @errors/edge_effects MAP_FAILED si shm_open, ftruncate ou mmap échoue.
+ *
+ * @examples base = shm_segment(size);
+ *
+ * @dependencies Dépend de shm_open, ftruncate, mmap, shm_unlink.
+ *
+ * @control_flow 1. Créer et dimensionner le segment.
+ *               2. Le projeter puis délier son nom.
+ */
+void	*shm_segment(size_t size)
+{
+	char	name[SHM_NAME_LEN];
+	int		fd;
+	void	*base;
+
+	snprintf(name, SHM_NAME_LEN, SHM_NAME, getpid());
+	fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, SHM_MODE);
+	if (fd < 0)
+		return (MAP_FAILED);
+	base = MAP_FAILED;
+	if (!ftruncate(fd, size))
+		base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	shm_unlink(name);
+	return (base);
+}
+
+/**
+ * @function private_segment
+ * @brief Projette un segment anonyme privé, en pages énormes si demandé.
+ *
+ * @param size: Taille voulue ; reçoit la taille réellement projetée.
+ * @param hugepages: Non nul avec --hugepages.
+ * @param pages: Reçoit le type de pages obtenu, ARENA_PAGES_*.
+ *
+ * @description Avec --hugepages, essaie d'abord MAP_HUGETLB sur une
+ * taille arrondie à HUGE_PAGE_SIZE. Sans pages réservées par le noyau
+ * (vm.nr_hugepages), retombe sur des pages normales et demande des
+ * pages énormes transparentes avec madvise.
+ *
+ * @return void*: Le segment, mis à zéro, ou MAP_FAILED.
+ *
+ * @errors/edge_effects MAP_FAILED si mmap échoue.
+ *
+ * @examples base = private_segment(&size, opts->hugepages, &pages);
+ *
+ * @dependencies Dépend de mmap et madvise.
+ *
+ * @control_flow 1. Tenter MAP_HUGETLB.
+ *               2. Sinon, pages normales, puis MADV_HUGEPAGE.
+ */
+void	*private_segment(size_t *size, int hugepages, int *pages)
+{
+	size_t	huge;
+	void	*base;
+
+	*pages = ARENA_PAGES_SMALL;
+	huge = (*size + HUGE_PAGE_SIZE - 1) & ~((size_t)HUGE_PAGE_SIZE - 1);
+	base = MAP_FAILED;
+	if (hugepages)
+		base = mmap(NULL, huge, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if (base != MAP_FAILED)
+	{
+		*size = huge;
+		*pages = ARENA_PAGES_HUGETLB;
+		return (base);
+	}
+	base = mmap(NULL, *size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (hugepages && base != MAP_FAILED
+		&& !madvise(base, *size, MADV_HUGEPAGE))
+		*pages = ARENA_PAGES_THP;
+	return (base);
+}
+
+/**
+ * @function print_arena_stats
+ * @brief Affiche l'arène et l'empreinte mémoire pour --stats.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Taille et remplissage de l'arène, type de pages, fautes
+ * de page mineures et RSS maximale du processus et de ses ouvriers :
+ * une faute mineure par page touchée, donc le nombre de pages du
+ * working set, et autant d'entrées de TLB à remplir.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples print_arena_stats(data);
+ *
+ * @dependencies Dépend de getrusage et fprintf.
+ *
+ * @control_flow 1. Lire les compteurs.
+ *               2. Imprimer.
+ */
+void	print_arena_stats(t_data *data)
+{
+	struct rusage	usage;
+	struct rusage	workers;
+	const char		*pages;
+
+	getrusage(RUSAGE_SELF, &usage);
+	getrusage(RUSAGE_CHILDREN, &workers);
+	pages = ARENA_SMALL_NAME;
+	if (data->arena.pages == ARENA_PAGES_HUGETLB)
+		pages = ARENA_HUGETLB_NAME;
+	else if (data->arena.pages == ARENA_PAGES_THP)
+		pages = ARENA_THP_NAME;
+	if (usage.ru_maxrss < workers.ru_maxrss)
+		usage.ru_maxrss = workers.ru_maxrss;
+	fprintf(stderr, STATS_ARENA, data->arena.used / KB_TO_BYTES,
+		data->arena.size / KB_TO_BYTES, pages,
+		usage.ru_minflt + workers.ru_minflt, usage.ru_maxrss);
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shared_mutex.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 20:52:19 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 20:52:19 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        shared_mutex_init
+ * @brief           Initialise un mutex, partagé entre processus ou non.
+ * @param pthread_mutex_t *mutex - Le mutex.
+ * @param int       shared - Non nul avec --processes.
+ * 
+ * @description     Avec shared, le mutex porte PTHREAD_PROCESS_SHARED :
+ *                  glibc attend alors sur un futex non privé, visible des
+ *                  processus qui partagent le segment. Il est aussi
+ *                  robuste : un processus ouvrier mort en le tenant ne
+ *                  bloque pas les autres, voir shared_mutex_lock.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @side_effect     Initialisation du mutex.
+ * 
+ * @example         shared_mutex_init(&data->write, data->arena.shared);
+ * 
+ * @dependencies    pthread_mutexattr_setpshared,
+ *                  pthread_mutexattr_setrobust, pthread_mutex_init
+ * 
+ * @control_flow    1. Préparation de l'attribut.
+ *                  2. Initialisation.
+ */
+int	shared_mutex_init(pthread_mutex_t *mutex, int shared)
+{
+	pthread_mutexattr_t	attr;
+	int					error;
+
+	if (pthread_mutexattr_init(&attr))
+		return (FAILURE);
+	error = shared && (pthread_mutexattr_setpshared(&attr,
+				PTHREAD_PROCESS_SHARED)
+			|| pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST));
+	if (!error)
+		error = pthread_mutex_init(mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+	if (error)
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @function        shared_mutex_lock
+ * @brief           Verrouille un mutex de shared_mutex_init.
+ * @param pthread_mutex_t *mutex - Le mutex.
+ * 
+ * @description     Si le détenteur précédent est un processus ouvrier
+ *                  mort, pthread_mutex_lock rend EOWNERDEAD avec le
+ *                  verrou acquis : l'état protégé est rendu cohérent et
+ *                  l'appelant continue. Sans --processes, équivaut à
+ *                  pthread_mutex_lock.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Acquisition du mutex.
+ * 
+ * @example         shared_mutex_lock(&data->write);
+ * 
+ * @dependencies    pthread_mutex_lock, pthread_mutex_consistent
+ * 
+ * @control_flow    1. Verrouillage.
+ *                  2. Reprise d'un mutex orphelin.
+ */
+void	shared_mutex_lock(pthread_mutex_t *mutex)
+{
+	if (pthread_mutex_lock(mutex) == EOWNERDEAD)
+		pthread_mutex_consistent(mutex);
+}
+
+/**
+ * @function        write_lock
+ * @brief           Verrouille le mutex d'écriture.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Dans un binaire make profile, mesure l'attente et
+ *                  commence la mesure de détention. Sinon, PROFILE_ENABLED
+ *                  vaut 0 et il ne reste que shared_mutex_lock.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Acquisition du mutex.
+ * 
+ * @example         write_lock(philo->shared_data);
+ * 
+ * @dependencies    shared_mutex_lock, profile_now, profile_acquired
+ * 
+ * @control_flow    1. Verrouillage, mesuré avec PHILO_PROFILE.
+ */
+void	write_lock(t_data *data)
+{
+	long	asked_at;
+
+	if (!PROFILE_ENABLED || !data->profiles)
+	{
+		shared_mutex_lock(&data->write);
+		return ;
+	}
+	asked_at = profile_now();
+	shared_mutex_lock(&data->write);
+	profile_acquired(&data->profiles[data->global_rules.n_philo], asked_at);
+}
+
+/**
+ * @function        write_unlock
+ * @brief           Déverrouille le mutex d'écriture.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Pendant de write_lock : la détention est enregistrée
+ *                  avant de rendre le mutex.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Libération du mutex.
+ * 
+ * @example         write_unlock(philo->shared_data);
+ * 
+ * @dependencies    pthread_mutex_unlock, profile_released
+ * 
+ * @control_flow    1. Mesure avec PHILO_PROFILE, puis libération.
+ */
+void	write_unlock(t_data *data)
+{
+	if (PROFILE_ENABLED && data->profiles)
+		profile_released(&data->profiles[data->global_rules.n_philo]);
+	pthread_mutex_unlock(&data->write);
+}
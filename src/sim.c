@@ -0,0 +1,228 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sim.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:32:19 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 15:32:19 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function init_simulation
+ * @brief Prépare la simulation à événements discrets.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Réutilise les tâches du mode --tasks. La file
+ * d'événements contient au plus, par philosophe, une étape et une
+ * vérification de mort : index i pour l'étape du philosophe i, n + i
+ * pour sa vérification de mort.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Arène épuisée.
+ *
+ * @examples if (data->opts.mode == MODE_SIMULATE && init_simulation(data))
+ *
+ * @dependencies Dépend de init_tasks, arena_alloc et sim_schedule.
+ *
+ * @control_flow 1. Allocation des tâches et de la file.
+ *               2. Premier pas de chaque philosophe à t = 0.
+ *               3. Première vérification de mort à t_die.
+ */
+int	init_simulation(t_data *data)
+{
+	int	n;
+	int	i;
+
+	n = data->global_rules.n_philo;
+	if (init_tasks(data))
+		return (FAILURE);
+	data->sim.events.nodes = arena_alloc(data, sizeof(t_deadline) * n * 2);
+	if (!data->sim.events.nodes)
+		return (FAILURE);
+	data->sim.events.size = 0;
+	data->sim.now = 0;
+	data->sim.seed = data->opts.seed;
+	data->sim.n_events = 0;
+	atomic_init(&data->sched.active, n);
+	i = -1;
+	while (++i < n)
+	{
+		sim_schedule(data, 0, i);
+		sim_schedule(data, data->global_rules.t_die + DEADLINE_GRACE_US,
+			n + i);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function sim_schedule
+ * @brief Programme un événement en temps virtuel.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param time: Date virtuelle de l'événement, en microsecondes.
+ * @param index: Étape (i) ou vérification de mort (n + i).
+ *
+ * @description La clé du tas est la date décalée de SIM_TIE_BITS ; les
+ * bits bas reçoivent un tirage du générateur congruentiel. Les
+ * événements simultanés sont donc départagés au hasard, mais toujours
+ * de la même façon pour une même graine.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Dates virtuelles limitées à 2^47 µs.
+ *
+ * @examples sim_schedule(data, data->sim.now, waiter - data->sched.tasks);
+ *
+ * @dependencies Dépend de deadline_heap_push.
+ *
+ * @control_flow 1. Tirage suivant du générateur.
+ *               2. Insertion de la clé dans le tas.
+ */
+void	sim_schedule(t_data *data, long time, int index)
+{
+	long	tie;
+
+	data->sim.seed = data->sim.seed * SIM_LCG_MUL + SIM_LCG_INC;
+	tie = (data->sim.seed >> SIM_TIE_SHIFT) & SIM_TIE_MASK;
+	deadline_heap_push(&data->sim.events, (time << SIM_TIE_BITS) | tie,
+		index);
+}
+
+/**
+ * @function sim_wait
+ * @brief Équivalent virtuel de ft_usleep pour une tâche.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param task: La tâche qui attend.
+ * @param duration: Durée de l'attente en microsecondes.
+ *
+ * @description Une durée négative (t_think quand t_die est court) ne
+ * fait pas attendre, comme ft_usleep.
+ *
+ * @return int: TASK_PARKED.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples return (sim_wait(data, task, rules->t_sleep));
+ *
+ * @dependencies Dépend de sim_schedule.
+ *
+ * @control_flow 1. Bornage de la durée.
+ *               2. Programmation de l'étape suivante.
+ */
+int	sim_wait(t_data *data, t_task *task, long duration)
+{
+	if (duration < 0)
+		duration = 0;
+	sim_schedule(data, data->sim.now + duration, task - data->sched.tasks);
+	return (TASK_PARKED);
+}
+
+/**
+ * @function check_sim_death
+ * @brief Vérification de mort d'un philosophe en temps virtuel.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param i: Index du philosophe.
+ *
+ * @description Même règle que refresh_deadline : mort si l'instant
+ * dépasse last_meal + t_die. Si le philosophe a mangé depuis, la
+ * vérification est reprogrammée à sa nouvelle échéance.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Un philosophe rassasié n'est plus surveillé.
+ *
+ * @examples check_sim_death(data, index - data->global_rules.n_philo);
+ *
+ * @dependencies Dépend de sim_schedule et emit_log_record.
+ *
+ * @control_flow 1. Ignorer un philosophe rassasié.
+ *               2. Reprogrammer si l'échéance n'est pas dépassée.
+ *               3. Sinon signaler et afficher la mort.
+ */
+void	check_sim_death(t_data *data, int i)
+{
+	t_philo			*philo;
+	t_log_record	record;
+	long			deadline;
+
+	philo = &data->philo[i];
+	if (!atomic_load_explicit(&philo->remaining_meal, memory_order_relaxed))
+		return ;
+	deadline = atomic_load_explicit(&philo->last_meal, memory_order_relaxed)
+		+ data->global_rules.t_die;
+	if (data->sim.now <= deadline)
+	{
+		sim_schedule(data, deadline + DEADLINE_GRACE_US,
+			data->global_rules.n_philo + i);
+		return ;
+	}
+	atomic_store_explicit(&data->someone_died, SOMEONE_DIED,
+		memory_order_relaxed);
+	record.time = data->sim.now;
+	record.id = i + PHILO_ID_OFFSET;
+	record.event = LOG_EV_DIED;
+	emit_log_record(&data->log, &record);
+}
+
+/**
+ * @function run_simulation
+ * @brief Boucle principale de la simulation.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Un seul thread : l'horloge virtuelle saute directement
+ * à l'événement suivant. Arrêt à la première mort, quand tous les
+ * philosophes sont rassasiés ou au-delà de --until.
+ *
+ * @return int: SUCCESS.
+ *
+ * @errors/edge_effects Sans quota de repas ni --until, une table qui
+ * survit tourne indéfiniment, comme en temps réel.
+ *
+ * @examples return (run_simulation(data));
+ *
+ * @dependencies Dépend de deadline_heap_pop, run_sim_step,
+ * check_sim_death, get_time et flush_log_output.
+ *
+ * @control_flow 1. Extraction de l'événement le plus proche.
+ *               2. Avance de l'horloge virtuelle.
+ *               3. Étape ou vérification de mort.
+ *               4. Mesure de la durée réelle et écriture du reste.
+ */
+int	run_simulation(t_data *data)
+{
+	t_sim	*sim;
+	long	start;
+	int		index;
+
+	sim = &data->sim;
+	start = get_time(0);
+	while (sim->events.size && !atomic_load_explicit(&data->someone_died,
+			memory_order_relaxed) && atomic_load_explicit(&data->sched.active,
+			memory_order_relaxed))
+	{
+		if (data->opts.until != SIM_NO_HORIZON && data->opts.until
+			< sim->events.nodes[0].deadline >> SIM_TIE_BITS)
+			break ;
+		sim->now = sim->events.nodes[0].deadline >> SIM_TIE_BITS;
+		index = sim->events.nodes[0].index;
+		deadline_heap_pop(&sim->events);
+		sim->n_events++;
+		if (index < data->global_rules.n_philo)
+			run_sim_step(data, &data->sched.tasks[index]);
+		else
+			check_sim_death(data, index - data->global_rules.n_philo);
+	}
+	data->t_end = get_time(0) - start;
+	flush_log_output(&data->log);
+	return (SUCCESS);
+}
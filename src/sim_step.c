@@ -0,0 +1,214 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sim_step.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:32:19 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 15:32:19 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function sim_log
+ * @brief Affiche une action à l'instant virtuel courant.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param philo: Le philosophe concerné.
+ * @param event: L'événement LOG_EV_*.
+ *
+ * @description Mêmes règles que log_action et print_meal : rien après
+ * une mort, après le dernier repas ou pour un philosophe seul, et un
+ * repas est précédé de ses deux fourchettes.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples sim_log(data, task->philo, LOG_EV_SLEEPING);
+ *
+ * @dependencies Dépend de should_philo_continue et emit_log_record.
+ *
+ * @control_flow 1. Filtrage comme en temps réel.
+ *               2. Affichage des fourchettes pour un repas.
+ *               3. Affichage de l'événement.
+ */
+void	sim_log(t_data *data, t_philo *philo, int event)
+{
+	t_log_record	record;
+
+	if (should_philo_continue(data, philo) || philo->rules->n_philo == ALONE)
+		return ;
+	record.time = data->sim.now;
+	record.id = philo->id;
+	record.event = LOG_EV_FORK;
+	if (event == LOG_EV_EAT)
+	{
+		emit_log_record(&data->log, &record);
+		emit_log_record(&data->log, &record);
+	}
+	record.event = event;
+	emit_log_record(&data->log, &record);
+}
+
+/**
+ * @function sim_release_fork
+ * @brief Rend une fourchette en temps virtuel.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param i: Index de la fourchette.
+ *
+ * @description Comme release_task_fork : l'attendant éventuel reçoit la
+ * fourchette et reprend à l'instant courant. Un seul thread, donc pas
+ * de verrou.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples sim_release_fork(data, task->second_fork);
+ *
+ * @dependencies Dépend de sim_schedule.
+ *
+ * @control_flow 1. Remise à l'attendant, ou libération.
+ */
+void	sim_release_fork(t_data *data, int i)
+{
+	t_fork	*fork;
+
+	fork = &data->forks[i];
+	if (!fork->waiter)
+	{
+		fork->taken = 0;
+		return ;
+	}
+	sim_schedule(data, data->sim.now, fork->waiter - data->sched.tasks);
+	fork->waiter = NULL;
+}
+
+/**
+ * @function sim_rest
+ * @brief Étapes "manger", "dormir" et "penser" en temps virtuel.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param task: La tâche courante.
+ *
+ * @description Pendant de rest_task : chaque attente devient un
+ * événement futur.
+ *
+ * @return int: TASK_PARKED.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples return (sim_rest(data, task));
+ *
+ * @dependencies Dépend de sim_log, finish_meal, sim_release_fork et
+ * sim_wait.
+ *
+ * @control_flow 1. Sélection de l'état.
+ *               2. Action puis attente virtuelle.
+ */
+int	sim_rest(t_data *data, t_task *task)
+{
+	if (task->state == TASK_EAT)
+	{
+		atomic_store_explicit(&task->philo->last_meal, data->sim.now,
+			memory_order_relaxed);
+		sim_log(data, task->philo, LOG_EV_EAT);
+		task->state = TASK_DONE_EATING;
+		return (sim_wait(data, task, task->philo->rules->t_eat));
+	}
+	if (task->state == TASK_DONE_EATING)
+	{
+		finish_meal(task->philo);
+		sim_release_fork(data, task->second_fork);
+		sim_release_fork(data, task->first_fork);
+		task->state = TASK_SLEEP;
+	}
+	if (task->state == TASK_SLEEP)
+	{
+		sim_log(data, task->philo, LOG_EV_SLEEPING);
+		task->state = TASK_THINK;
+		return (sim_wait(data, task, task->philo->rules->t_sleep));
+	}
+	sim_log(data, task->philo, LOG_EV_THINKING);
+	task->state = TASK_CHECK;
+	return (sim_wait(data, task, task->philo->rules->t_think));
+}
+
+/**
+ * @function sim_advance
+ * @brief Exécute un état d'un philosophe en temps virtuel.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param task: La tâche courante.
+ *
+ * @description Pendant de advance_task : même décalage des impairs et
+ * même ordre des fourchettes que initiate_eating_process.
+ *
+ * @return int: TASK_CONTINUE, TASK_PARKED ou TASK_DONE.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples status = sim_advance(data, task);
+ *
+ * @dependencies Dépend de sim_wait, take_task_forks et sim_rest.
+ *
+ * @control_flow 1. Décalage initial des philosophes impairs.
+ *               2. Prise des fourchettes.
+ *               3. Repas, sommeil et réflexion.
+ *               4. Fin de la tâche ou nouveau cycle.
+ */
+int	sim_advance(t_data *data, t_task *task)
+{
+	if (task->state == TASK_START)
+	{
+		task->state = TASK_TAKE_FIRST;
+		if (task->philo->id % 2)
+			return (sim_wait(data, task,
+					task->philo->rules->t_eat / US_TO_MS));
+	}
+	if (task->state == TASK_TAKE_FIRST || task->state == TASK_TAKE_SECOND)
+		return (take_task_forks(data, task));
+	if (task->state != TASK_CHECK)
+		return (sim_rest(data, task));
+	if (should_philo_continue(data, task->philo))
+		return (TASK_DONE);
+	task->state = TASK_TAKE_FIRST;
+	return (TASK_CONTINUE);
+}
+
+/**
+ * @function run_sim_step
+ * @brief Fait avancer une tâche jusqu'à sa prochaine attente virtuelle.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param task: La tâche à reprendre.
+ *
+ * @description Pendant de run_task_step pour la simulation.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples run_sim_step(data, &data->sched.tasks[index]);
+ *
+ * @dependencies Dépend de sim_advance.
+ *
+ * @control_flow 1. Avancer tant que TASK_CONTINUE.
+ *               2. Décompter la tâche si elle est terminée.
+ */
+void	run_sim_step(t_data *data, t_task *task)
+{
+	int	status;
+
+	status = TASK_CONTINUE;
+	while (status == TASK_CONTINUE)
+		status = sim_advance(data, task);
+	if (status == TASK_DONE)
+		atomic_fetch_sub_explicit(&data->sched.active, 1,
+			memory_order_relaxed);
+}
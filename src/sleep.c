@@ -0,0 +1,184 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sleep.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:40:52 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 11:40:52 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        futex_wait_until
+ * @brief           Attend un changement du mot futex jusqu'à une échéance.
+ * @param atomic_int *word - Le mot surveillé.
+ * @param int       expected - La valeur tant que dure l'attente.
+ * @param long      deadline - Échéance absolue CLOCK_MONOTONIC en µs.
+ * 
+ * @description     FUTEX_WAIT_BITSET prend une échéance absolue sur l'horloge
+ *                  monotone : aucun calcul de durée relative, donc aucune
+ *                  dérive entre deux réveils. Le futex n'est pas privé pour
+ *                  rester utilisable en mémoire partagée.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Bloque le thread dans le noyau.
+ * 
+ * @example         futex_wait_until(&data->someone_died, 0, deadline);
+ * 
+ * @dependencies    syscall, SYS_futex
+ * 
+ * @control_flow    1. Conversion de l'échéance en timespec.
+ *                  2. Attente sur le mot tant qu'il vaut 'expected'.
+ */
+void	futex_wait_until(atomic_int *word, int expected, long deadline)
+{
+	struct timespec	ts;
+
+	ts.tv_sec = deadline / SEC_TO_US;
+	ts.tv_nsec = (deadline % SEC_TO_US) * US_TO_NS;
+	syscall(SYS_futex, (int *)word, FUTEX_WAIT_BITSET, expected, &ts,
+		NULL, FUTEX_BITSET_MATCH_ANY);
+}
+
+/**
+ * @function        futex_wake_all
+ * @brief           Réveille tous les threads en attente sur un mot futex.
+ * @param atomic_int *word - Le mot dont la valeur vient de changer.
+ * 
+ * @description     À appeler après avoir publié la nouvelle valeur du mot.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Réveil des threads en attente.
+ * 
+ * @example         futex_wake_all(&data->someone_died);
+ * 
+ * @dependencies    syscall, SYS_futex
+ * 
+ * @control_flow    1. FUTEX_WAKE sur tous les attendants.
+ */
+void	futex_wake_all(atomic_int *word)
+{
+	syscall(SYS_futex, (int *)word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+/**
+ * @function        calibrate_sleep_tail
+ * @brief           Mesure le retard de réveil du noyau.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Effectue SLEEP_CALIBRATION_ROUNDS attentes courtes et
+ *                  retient le plus grand dépassement observé. Cette durée
+ *                  devient la queue d'attente active de sleep_until.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Bloque environ SLEEP_CALIBRATION_ROUNDS fois
+ *                  SLEEP_CALIBRATION_US.
+ * 
+ * @example         calibrate_sleep_tail(data);
+ * 
+ * @dependencies    futex_wait_until, get_time
+ * 
+ * @control_flow    1. Attentes courtes sur un mot local.
+ *                  2. Mémorisation du pire dépassement.
+ *                  3. Bornage de la queue.
+ */
+void	calibrate_sleep_tail(t_data *data)
+{
+	atomic_int	word;
+	long		deadline;
+	long		overshoot;
+	int			round;
+
+	atomic_init(&word, 0);
+	data->sleep_tail = SLEEP_TAIL_MIN_US;
+	round = 0;
+	while (round++ < SLEEP_CALIBRATION_ROUNDS)
+	{
+		deadline = get_time(0) + SLEEP_CALIBRATION_US;
+		futex_wait_until(&word, 0, deadline);
+		overshoot = get_time(0) - deadline;
+		if (overshoot > data->sleep_tail)
+			data->sleep_tail = overshoot;
+	}
+	if (data->sleep_tail > SLEEP_TAIL_MAX_US)
+		data->sleep_tail = SLEEP_TAIL_MAX_US;
+}
+
+/**
+ * @function        sleep_until
+ * @brief           Dort jusqu'à une échéance absolue, annulable.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param long      deadline - Échéance absolue CLOCK_MONOTONIC en µs.
+ * 
+ * @description     Attend sur le mot futex 'someone_died' jusqu'à l'échéance
+ *                  moins la queue calibrée, puis attend activement la courte
+ *                  queue restante. Une mort réveille l'attente à l'instant :
+ *                  plus aucune scrutation périodique.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Pause dans l'exécution du thread.
+ * 
+ * @example         sleep_until(data, get_time(0) + 200000);
+ * 
+ * @dependencies    futex_wait_until, get_time
+ * 
+ * @control_flow    1. Attente noyau tant que l'échéance est lointaine.
+ *                  2. Queue active jusqu'à l'échéance.
+ *                  3. Sortie immédiate si quelqu'un est mort.
+ */
+void	sleep_until(t_data *data, long deadline)
+{
+	long	now;
+
+	now = get_time(0);
+	while (now < deadline
+		&& !atomic_load_explicit(&data->someone_died, memory_order_acquire))
+	{
+		if (deadline - now > data->sleep_tail)
+			futex_wait_until(&data->someone_died, NO_ONE_DIED,
+				deadline - data->sleep_tail);
+		now = get_time(0);
+	}
+}
+
+/**
+ * @function        ft_usleep
+ * @brief           Met en pause l'exécution pendant une durée.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param long      duration - Durée de la pause en microsecondes.
+ * 
+ * @description     Convertit la durée en échéance absolue et délègue à
+ *                  sleep_until. La pause est interrompue par une mort.
+ *                  Avec PHILO_HISTO, le retard au réveil d'une pause
+ *                  menée à terme est enregistré.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Pause dans l'exécution du thread.
+ * 
+ * @example         ft_usleep(shared_data, 500000);
+ * 
+ * @dependencies    get_time, sleep_until, histo_record
+ * 
+ * @control_flow    1. Calcul de l'échéance.
+ *                  2. Attente jusqu'à l'échéance.
+ *                  3. Mesure du retard.
+ */
+void	ft_usleep(t_data *data, long duration)
+{
+	long	deadline;
+
+	deadline = get_time(0) + duration;
+	sleep_until(data, deadline);
+	if (HISTO_ENABLED && duration > 0
+		&& !atomic_load_explicit(&data->someone_died, memory_order_relaxed))
+		histo_record(&data->histos.sleep, get_time(0) - deadline);
+}
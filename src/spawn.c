@@ -0,0 +1,208 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:07:48 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 22:07:48 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        create_philosopher_range
+ * @brief           Crée les threads des philosophes [first, last[.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param int       first - Premier indice.
+ * @param int       last - Indice de fin, exclu.
+ * 
+ * @description     Pile de --stack-size Kio, STACK_DEFAULT_KB par défaut,
+ *                  au lieu des 8 Mio de glibc : un philosophe n'appelle
+ *                  ni printf ni malloc, tout passe par l'anneau du
+ *                  journal. 0 garde la pile par défaut ; jamais moins de
+ *                  PTHREAD_STACK_MIN. Chaque thread attend ensuite à la
+ *                  porte de départ : l'ordre et la durée de création ne
+ *                  comptent plus dans la mesure du temps.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE_CREAT_THREADS.
+ * 
+ * @side_effect     Création de threads.
+ * 
+ * @example         error = create_philosopher_range(data, 0, n);
+ * 
+ * @dependencies    pthread_attr_setstacksize, pthread_create,
+ *                  run_philosopher_routine
+ * 
+ * @control_flow    1. Taille de pile bornée par PTHREAD_STACK_MIN.
+ *                  2. Création des threads un par un.
+ */
+int	create_philosopher_range(t_data *data, int first, int last)
+{
+	pthread_attr_t	attr;
+	size_t			size;
+	int				error;
+
+	size = data->opts.stack_size;
+	if (size && size < (size_t)PTHREAD_STACK_MIN)
+		size = PTHREAD_STACK_MIN;
+	if (pthread_attr_init(&attr))
+		return (FAILURE_CREAT_THREADS);
+	error = size && pthread_attr_setstacksize(&attr, size);
+	while (!error && first < last)
+	{
+		if (pthread_create(&data->thread_ids[first], &attr,
+				&run_philosopher_routine, &data->philo[first]))
+			error = FAILURE_CREAT_THREADS;
+		first++;
+	}
+	pthread_attr_destroy(&attr);
+	if (error)
+		return (FAILURE_CREAT_THREADS);
+	return (SUCCESS);
+}
+
+/**
+ * @function        run_spawner
+ * @brief           Corps d'un thread de création.
+ * @param void      *valise - Le t_spawner de ce thread.
+ * 
+ * @description     Crée la tranche de philosophes qui lui revient.
+ * 
+ * @return          NULL.
+ * 
+ * @side_effect     Création de threads, code d'erreur dans le t_spawner.
+ * 
+ * @example         pthread_create(&s->thread, NULL, &run_spawner, s);
+ * 
+ * @dependencies    create_philosopher_range
+ * 
+ * @control_flow    1. Création de la tranche.
+ */
+void	*run_spawner(void *valise)
+{
+	t_spawner	*spawner;
+
+	spawner = (t_spawner *) valise;
+	spawner->error = create_philosopher_range(spawner->data,
+			spawner->first, spawner->last);
+	return (NULL);
+}
+
+/**
+ * @function        join_spawners
+ * @brief           Rejoint les threads de création et libère leur table.
+ * @param t_spawner *spawners - La table.
+ * @param int       n - Nombre de threads lancés.
+ * 
+ * @description     Tous sont rejoints, même après un échec.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE_CREAT_THREADS.
+ * 
+ * @side_effect     Libération de spawners.
+ * 
+ * @example         return (join_spawners(spawners, n));
+ * 
+ * @dependencies    pthread_join, free
+ * 
+ * @control_flow    1. Jointure et relevé des erreurs.
+ *                  2. Libération.
+ */
+int	join_spawners(t_spawner *spawners, int n)
+{
+	int	error;
+	int	i;
+
+	error = SUCCESS;
+	i = 0;
+	while (i < n)
+	{
+		if (pthread_join(spawners[i].thread, NULL) || spawners[i].error)
+			error = FAILURE_CREAT_THREADS;
+		i++;
+	}
+	free(spawners);
+	return (error);
+}
+
+/**
+ * @function        launch_spawners
+ * @brief           Lance les threads de création, un par tranche.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param t_spawner *spawners - La table, de n entrées.
+ * @param int       n - Nombre de tranches contiguës.
+ * 
+ * @description     S'arrête au premier échec de pthread_create.
+ * 
+ * @return          Le nombre de threads lancés.
+ * 
+ * @side_effect     Création de threads.
+ * 
+ * @example         launched = launch_spawners(data, spawners, n);
+ * 
+ * @dependencies    pthread_create, run_spawner
+ * 
+ * @control_flow    1. Bornes de chaque tranche et lancement.
+ */
+int	launch_spawners(t_data *data, t_spawner *spawners, int n)
+{
+	int	i;
+
+	i = 0;
+	while (i < n)
+	{
+		spawners[i].data = data;
+		spawners[i].first = (long)data->global_rules.n_philo * i / n;
+		spawners[i].last = (long)data->global_rules.n_philo * (i + 1) / n;
+		if (pthread_create(&spawners[i].thread, NULL, &run_spawner,
+				&spawners[i]))
+			return (i);
+		i++;
+	}
+	return (i);
+}
+
+/**
+ * @function        create_philosopher_threads
+ * @brief           Crée un thread par philosophe, en parallèle.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Mode historique : chaque philosophe exécute
+ *                  run_philosopher_routine dans son propre thread. Au-delà
+ *                  de SPAWN_BATCH philosophes, la création est répartie
+ *                  sur jusqu'à --workers threads de création, un par cœur
+ *                  par défaut, chacun sur une tranche contiguë.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE_CREAT_THREADS.
+ * 
+ * @side_effect     Création de threads.
+ * 
+ * @example         if (create_philosopher_threads(data))
+ * 
+ * @dependencies    create_philosopher_range, launch_spawners,
+ *                  join_spawners
+ * 
+ * @control_flow    1. Choix du nombre de threads de création.
+ *                  2. Lancement puis jointure des tranches.
+ */
+int	create_philosopher_threads(t_data *data)
+{
+	t_spawner	*spawners;
+	int			n;
+	int			launched;
+
+	n = data->global_rules.n_philo / SPAWN_BATCH;
+	if (n > data->opts.n_workers)
+		n = data->opts.n_workers;
+	if (n <= 1)
+		return (create_philosopher_range(data, 0, data->global_rules.n_philo));
+	spawners = malloc(sizeof(t_spawner) * n);
+	if (!spawners)
+		return (FAILURE_CREAT_THREADS);
+	launched = launch_spawners(data, spawners, n);
+	if (join_spawners(spawners, launched) || launched < n)
+		return (FAILURE_CREAT_THREADS);
+	return (SUCCESS);
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   start_gate.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:19:26 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 22:19:26 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function parse_stack_size
+ * @brief Lit la valeur de --stack-size=KB.
+ *
+ * @param value: Texte après le '=', en Kio.
+ * @param opts: Pointeur vers les options.
+ *
+ * @description 0 garde la pile par défaut de glibc. Les petites valeurs
+ * sont relevées à PTHREAD_STACK_MIN à la création des threads.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples parse_stack_size("64", &opts);
+ *
+ * @dependencies Dépend de is_valid_number et ft_atol.
+ *
+ * @control_flow 1. Vérifier puis convertir en octets.
+ */
+int	parse_stack_size(const char *value, t_options *opts)
+{
+	if (is_valid_number(value, 0))
+		return (FAILURE);
+	opts->stack_size = ft_atol(value) * KB_TO_BYTES;
+	return (SUCCESS);
+}
+
+/**
+ * @function wait_start_gate
+ * @brief Attend l'ouverture de la porte de départ.
+ *
+ * @param philo: Pointeur vers la structure t_philo.
+ *
+ * @description Le philosophe se compte prêt, réveille le coordinateur
+ * s'il est le dernier, puis dort sur le futex de la porte. Le futex
+ * n'est pas privé : la porte sert aussi aux processus de --processes.
+ * t0 est fixé à l'ouverture, l'heure de sortie est gardée pour --stats.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples wait_start_gate(philo);
+ *
+ * @dependencies Dépend de futex_wake_all, futex_wait et get_time.
+ *
+ * @control_flow 1. Se compter prêt.
+ *               2. Attendre l'ouverture.
+ *               3. Noter l'heure de départ.
+ */
+void	wait_start_gate(t_philo *philo)
+{
+	t_data	*data;
+
+	data = philo->shared_data;
+	if (atomic_fetch_add_explicit(&data->ready, 1, memory_order_acq_rel) + 1
+		== data->global_rules.n_philo)
+		futex_wake_all(&data->ready);
+	while (atomic_load_explicit(&data->start_gate, memory_order_acquire)
+		== GATE_CLOSED)
+		futex_wait(&data->start_gate, GATE_CLOSED);
+	philo->started_at = get_time(data->t0);
+}
+
+/**
+ * @function open_start_gate
+ * @brief Libère tous les philosophes d'un coup et fixe t0.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Attend que chaque philosophe soit à la porte, au plus
+ * START_GATE_TIMEOUT_US, puis fixe t0 et ouvre : le dernier créé part
+ * en même temps que le premier. Le temps écoulé depuis l'ancien t0,
+ * création comprise, est gardé pour --stats. Le mode tâches n'a pas de
+ * porte.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Passé le délai, la porte s'ouvre quand même : un
+ * processus ouvrier mort au démarrage ne bloque pas la table, ses
+ * philosophes meurent de faim.
+ *
+ * @examples open_start_gate(data);
+ *
+ * @dependencies Dépend de futex_wait_until, futex_wake_all et get_time.
+ *
+ * @control_flow 1. Attendre tous les philosophes.
+ *               2. Fixer t0 et mesurer le démarrage.
+ *               3. Ouvrir la porte.
+ */
+void	open_start_gate(t_data *data)
+{
+	long	deadline;
+	int		ready;
+
+	if (data->opts.mode == MODE_TASKS)
+		return ;
+	deadline = get_time(0) + START_GATE_TIMEOUT_US;
+	ready = atomic_load_explicit(&data->ready, memory_order_acquire);
+	while (ready < data->global_rules.n_philo && get_time(0) < deadline)
+	{
+		futex_wait_until(&data->ready, ready, deadline);
+		ready = atomic_load_explicit(&data->ready, memory_order_acquire);
+	}
+	deadline = data->t0;
+	data->t0 = get_time(0);
+	data->startup_us = data->t0 - deadline;
+	atomic_store_explicit(&data->start_gate, GATE_OPEN, memory_order_release);
+	futex_wake_all(&data->start_gate);
+}
+
+/**
+ * @function print_startup_stats
+ * @brief Affiche le coût et l'équité du démarrage pour --stats.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Durée de la création jusqu'à l'ouverture, retard du
+ * dernier thread sur l'ouverture, et premier et dernier premiers repas.
+ * Le décalage des impairs, t_eat, fait partie de l'écart des repas.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Les philosophes qui n'ont pas mangé sont ignorés
+ * pour les repas. Rien en mode tâches, qui n'a pas de porte.
+ *
+ * @examples print_startup_stats(data);
+ *
+ * @dependencies Dépend de fprintf.
+ *
+ * @control_flow 1. Parcourir les philosophes.
+ *               2. Imprimer.
+ */
+void	print_startup_stats(t_data *data)
+{
+	long	last_start;
+	long	first;
+	long	last;
+	int		i;
+
+	if (data->opts.mode == MODE_TASKS)
+		return ;
+	last_start = 0;
+	first = LONG_MAX;
+	last = 0;
+	i = -1;
+	while (++i < data->global_rules.n_philo)
+	{
+		if (data->philo[i].started_at > last_start)
+			last_start = data->philo[i].started_at;
+		if (data->philo[i].first_meal == NO_MEAL_YET)
+			continue ;
+		if (data->philo[i].first_meal < first)
+			first = data->philo[i].first_meal;
+		if (data->philo[i].first_meal > last)
+			last = data->philo[i].first_meal;
+	}
+	if (first > last)
+		first = last;
+	fprintf(stderr, STATS_STARTUP, data->startup_us, last_start, first, last);
+}
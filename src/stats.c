@@ -0,0 +1,182 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:18 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 13:41:18 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        count_meals
+ * @brief           Compte les repas pris par toute la table.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Somme des meals_eaten, lus après la jointure.
+ * 
+ * @return          Le nombre total de repas.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         meals = count_meals(data);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Parcours des philosophes.
+ */
+long	count_meals(t_data *data)
+{
+	long	meals;
+	int		i;
+
+	meals = 0;
+	i = 0;
+	while (i < data->global_rules.n_philo)
+		meals += data->philo[i++].meals_eaten;
+	return (meals);
+}
+
+/**
+ * @function        count_task_switches
+ * @brief           Compte les reprises de tâches du mode tâches.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Une reprise de tâche par un ouvrier est l'équivalent
+ *                  en espace utilisateur d'un changement de contexte.
+ * 
+ * @return          Le total des reprises, 0 en mode threads.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         switches = count_task_switches(data);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Parcours des ouvriers.
+ */
+long	count_task_switches(t_data *data)
+{
+	long	switches;
+	int		i;
+
+	switches = 0;
+	if (data->opts.mode != MODE_TASKS)
+		return (switches);
+	i = 0;
+	while (i < data->sched.n_workers)
+		switches += data->sched.workers[i++].switches;
+	return (switches);
+}
+
+/**
+ * @function        stats_mode_name
+ * @brief           Nom du mode d'exécution pour --stats.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     threads, tasks, simulate ou processes.
+ * 
+ * @return          Le nom du mode.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         printf("%s", stats_mode_name(data));
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Sélection selon data->opts.mode.
+ */
+char	*stats_mode_name(t_data *data)
+{
+	if (data->opts.mode == MODE_TASKS)
+		return (STATS_MODE_TASKS);
+	if (data->opts.mode == MODE_SIMULATE)
+		return (STATS_MODE_SIMULATE);
+	if (data->opts.n_procs > 1)
+		return (STATS_MODE_PROCESSES);
+	return (STATS_MODE_THREADS);
+}
+
+/**
+ * @function        print_stats
+ * @brief           Affiche les statistiques du run sur stderr.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Donne le mode, le débit de repas et les changements de
+ *                  contexte volontaires et involontaires du processus et
+ *                  de ses processus ouvriers avec --processes, plus
+ *                  les changements de tâche en mode tâches. En simulation,
+ *                  la durée est réelle et s'ajoutent le temps simulé et
+ *                  le nombre d'événements ; sinon l'attente des
+ *                  fourchettes et le verrou. Dans tous les modes, l'arène
+ *                  et l'empreinte mémoire. stdout n'est pas touché.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Impression sur stderr.
+ * 
+ * @example         if (data.opts.stats) print_stats(&data);
+ * 
+ * @dependencies    getrusage, count_meals, count_task_switches,
+ *                  stats_mode_name, print_table_stats,
+ *                  print_arena_stats
+ * 
+ * @control_flow    1. Lecture des compteurs du processus.
+ *                  2. Calcul du débit.
+ *                  3. Impression.
+ */
+void	print_stats(t_data *data)
+{
+	struct rusage	usage;
+	struct rusage	workers;
+	long			meals;
+	long			wall;
+
+	getrusage(RUSAGE_SELF, &usage);
+	getrusage(RUSAGE_CHILDREN, &workers);
+	meals = count_meals(data);
+	wall = data->t_end;
+	if (wall < 1)
+		wall = 1;
+	fprintf(stderr, STATS_RUN, stats_mode_name(data),
+		data->global_rules.n_philo, meals, wall / US_TO_MS,
+		(double)meals * SEC_TO_US / wall);
+	fprintf(stderr, STATS_SWITCHES, usage.ru_nvcsw + workers.ru_nvcsw,
+		usage.ru_nivcsw + workers.ru_nivcsw, count_task_switches(data));
+	if (data->opts.mode == MODE_SIMULATE)
+		fprintf(stderr, STATS_SIM, data->sim.now / US_TO_MS,
+			data->sim.n_events);
+	else
+		print_table_stats(data, meals);
+	print_arena_stats(data);
+}
+
+/**
+ * @function        print_histograms
+ * @brief           Affiche les histogrammes de latence en fin de run.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Compilé avec PHILO_HISTO (make histo) : latence de
+ *                  détection de mort, retard des réveils de ft_usleep et
+ *                  attente entre fourchettes et repas.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Impression sur stderr.
+ * 
+ * @example         if (HISTO_ENABLED) print_histograms(&data);
+ * 
+ * @dependencies    print_histo
+ * 
+ * @control_flow    1. Une ligne par histogramme.
+ */
+void	print_histograms(t_data *data)
+{
+	print_histo(HISTO_DEATH, &data->histos.death);
+	print_histo(HISTO_SLEEP, &data->histos.sleep);
+	print_histo(HISTO_FORK_TO_EAT, &data->histos.fork_to_eat);
+}
@@ -0,0 +1,181 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_forks.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:12:40 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 19:12:40 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        print_fork_stats
+ * @brief           Affiche l'attente des fourchettes et la marge minimale.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param long      meals - Nombre total de repas.
+ * 
+ * @description     Attente moyenne et maximale entre note_hungry et le
+ *                  repas, et plus petite marge restante avant t_die au
+ *                  moment de manger : proche de zéro, la stratégie affame.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stderr.
+ * 
+ * @example         print_fork_stats(data, meals);
+ * 
+ * @dependencies    fprintf
+ * 
+ * @control_flow    1. Agrégation par philosophe.
+ *                  2. Affichage.
+ */
+void	print_fork_stats(t_data *data, long meals)
+{
+	long	wait_total;
+	long	wait_max;
+	long	min_slack;
+	int		i;
+
+	wait_total = 0;
+	wait_max = 0;
+	min_slack = LONG_MAX;
+	i = -1;
+	while (++i < data->global_rules.n_philo)
+	{
+		wait_total += data->philo[i].wait_total;
+		if (data->philo[i].wait_max > wait_max)
+			wait_max = data->philo[i].wait_max;
+		if (data->philo[i].min_slack < min_slack)
+			min_slack = data->philo[i].min_slack;
+	}
+	if (meals < 1)
+		meals = 1;
+	if (min_slack == LONG_MAX)
+		min_slack = 0;
+	fprintf(stderr, STATS_FORKS, data->strategy->name, wait_total / meals,
+		wait_max, min_slack);
+}
+
+/**
+ * @function        average_wait
+ * @brief           Attente moyenne des fourchettes d'un philosophe.
+ * @param t_philo   *philo - Le philosophe.
+ * 
+ * @description     Zéro s'il n'a jamais mangé.
+ * 
+ * @return          L'attente moyenne en µs.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         avg = average_wait(&data->philo[i]);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Division par le nombre de repas.
+ */
+long	average_wait(t_philo *philo)
+{
+	if (!philo->meals_eaten)
+		return (0);
+	return (philo->wait_total / philo->meals_eaten);
+}
+
+/**
+ * @function        neighbour_wait_gap
+ * @brief           Plus grand écart d'attente moyenne entre deux voisins.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Mesure d'équité d'un verrou : deux voisins se disputent
+ *                  la même fourchette, un verrou injuste sert l'un
+ *                  nettement plus vite que l'autre.
+ * 
+ * @return          L'écart en µs.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         gap = neighbour_wait_gap(data);
+ * 
+ * @dependencies    average_wait
+ * 
+ * @control_flow    1. Écart avec le voisin de droite, dans les deux sens.
+ */
+long	neighbour_wait_gap(t_data *data)
+{
+	long	gap;
+	long	diff;
+	int		n;
+	int		i;
+
+	n = data->global_rules.n_philo;
+	gap = 0;
+	i = -1;
+	while (++i < n)
+	{
+		diff = average_wait(&data->philo[i])
+			- average_wait(&data->philo[(i + 1) % n]);
+		if (diff > gap)
+			gap = diff;
+		if (-diff > gap)
+			gap = -diff;
+	}
+	return (gap);
+}
+
+/**
+ * @function        print_lock_stats
+ * @brief           Affiche le verrou des fourchettes et son coût.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Taille du verrou choisi avec --lock et place réelle
+ *                  d'une fourchette : chacune occupe sa ligne de cache,
+ *                  quel que soit le verrou. Puis l'écart d'attente entre
+ *                  voisins.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Écriture sur stderr.
+ * 
+ * @example         print_lock_stats(data);
+ * 
+ * @dependencies    neighbour_wait_gap, fprintf
+ * 
+ * @control_flow    1. Affichage.
+ */
+void	print_lock_stats(t_data *data)
+{
+	fprintf(stderr, STATS_LOCK, data->locks->name, data->locks->size,
+		sizeof(t_fork), neighbour_wait_gap(data));
+}
+
+/**
+ * @function        print_table_stats
+ * @brief           Statistiques propres à une vraie table, hors simulation.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * @param long      meals - Nombre total de repas.
+ * 
+ * @description     Fourchettes, verrou, placement, démarrage et arrêt.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Impression sur stderr.
+ * 
+ * @example         print_table_stats(data, meals);
+ * 
+ * @dependencies    print_fork_stats, print_lock_stats,
+ *                  print_affinity_stats, print_startup_stats,
+ *                  print_stop_stats
+ * 
+ * @control_flow    1. Une ligne par famille.
+ */
+void	print_table_stats(t_data *data, long meals)
+{
+	print_fork_stats(data, meals);
+	print_lock_stats(data);
+	print_affinity_stats(data);
+	print_startup_stats(data);
+	print_stop_stats(data);
+}
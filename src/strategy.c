@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strategy.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:20:44 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 17:20:44 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        get_strategy
+ * @brief           Donne la stratégie de prise des fourchettes.
+ * @param int       id - STRATEGY_*.
+ * 
+ * @description     Table des stratégies : nom pour --strategy, init
+ *                  éventuelle, prise et rendu des fourchettes.
+ * 
+ * @return          Pointeur vers la stratégie.
+ * 
+ * @side_effect     Aucun.
+ * 
+ * @example         data->strategy = get_strategy(data->opts.strategy);
+ * 
+ * @dependencies    Aucune.
+ * 
+ * @control_flow    1. Indexation de la table.
+ */
+t_strategy	*get_strategy(int id)
+{
+	static t_strategy	strategies[STRATEGY_COUNT] = {
+	{"oddeven", NULL, &ordered_take, &ordered_put},
+	{"hierarchy", NULL, &ordered_take, &ordered_put},
+	{"waiter", &waiter_init, &waiter_take, &waiter_put},
+	{"chandy", &chandy_init, &chandy_take, &chandy_put}};
+
+	return (&strategies[id]);
+}
+
+/**
+ * @function        parse_strategy
+ * @brief           Lit la valeur de --strategy=.
+ * @param const     char *name - Nom de la stratégie.
+ * @param t_options *opts - Reçoit son identifiant.
+ * 
+ * @description     Noms reconnus : oddeven, hierarchy, waiter, chandy.
+ * 
+ * @return          SUCCESS ou FAILURE si le nom est inconnu.
+ * 
+ * @side_effect     Modification des options.
+ * 
+ * @example         parse_strategy("waiter", opts);
+ * 
+ * @dependencies    get_strategy, strcmp
+ * 
+ * @control_flow    1. Recherche du nom dans la table.
+ */
+int	parse_strategy(const char *name, t_options *opts)
+{
+	int	i;
+
+	i = 0;
+	while (i < STRATEGY_COUNT)
+	{
+		if (!strcmp(name, get_strategy(i)->name))
+		{
+			opts->strategy = i;
+			return (SUCCESS);
+		}
+		i++;
+	}
+	return (FAILURE);
+}
+
+/**
+ * @function        ordered_take
+ * @brief           Prend les deux fourchettes dans un ordre fixe.
+ * @param t_philo   *philo - Le philosophe.
+ * 
+ * @description     Stratégies oddeven et hierarchy : l'ordre vient de
+ *                  get_fork_order, qui garantit l'absence de cycle. Les
+ *                  fourchettes sont tenues pendant tout le repas du
+ *                  voisin : l'attente se fait aussi sur le jeton d'arrêt.
+ * 
+ * @return          SUCCESS : les deux fourchettes sont verrouillées.
+ *                  FAILURE : l'arrêt a interrompu l'attente, aucune
+ *                  fourchette n'est tenue.
+ * 
+ * @side_effect     Verrouillage de deux fourchettes, peut bloquer.
+ * 
+ * @example         if (strategy->take(philo))
+ * 
+ * @dependencies    get_fork_order, fork_lock, fork_unlock
+ * 
+ * @control_flow    1. Ordre des fourchettes.
+ *                  2. Verrouillage dans cet ordre, sauf arrêt.
+ *                  3. Sur arrêt, rendre la première fourchette.
+ */
+int	ordered_take(t_philo *philo)
+{
+	t_data	*data;
+	int		first_fork;
+	int		second_fork;
+
+	data = philo->shared_data;
+	get_fork_order(philo, &first_fork, &second_fork);
+	if (fork_lock(data, &data->forks[first_fork], &data->someone_died))
+		return (FAILURE);
+	if (fork_lock(data, &data->forks[second_fork], &data->someone_died))
+	{
+		fork_unlock(data, &data->forks[first_fork]);
+		return (FAILURE);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        ordered_put
+ * @brief           Rend les deux fourchettes prises par ordered_take.
+ * @param t_philo   *philo - Le philosophe.
+ * 
+ * @description     Déverrouillage dans l'ordre inverse de la prise.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Déverrouillage de deux fourchettes.
+ * 
+ * @example         strategy->put(philo);
+ * 
+ * @dependencies    get_fork_order, fork_unlock
+ * 
+ * @control_flow    1. Déverrouillage de la seconde puis de la première.
+ */
+void	ordered_put(t_philo *philo)
+{
+	t_data	*data;
+	int		first_fork;
+	int		second_fork;
+
+	data = philo->shared_data;
+	get_fork_order(philo, &first_fork, &second_fork);
+	fork_unlock(data, &data->forks[second_fork]);
+	fork_unlock(data, &data->forks[first_fork]);
+}
+
+/**
+ * @function        strategy_wake
+ * @brief           Réveille les attentes propres à la stratégie sur arrêt.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     futex_wake_all ne réveille que les attentes sur le mot
+ *                  someone_died. Les places du serveur passent par une
+ *                  condition : elle est diffusée sous son verrou, après
+ *                  la publication de l'arrêt.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Diffusion de seat_freed avec --strategy=waiter.
+ * 
+ * @example         strategy_wake(data);
+ * 
+ * @dependencies    pthread_mutex_lock, pthread_cond_broadcast
+ * 
+ * @control_flow    1. Rien hors de la stratégie waiter.
+ *                  2. Diffusion sous le verrou du serveur.
+ */
+void	strategy_wake(t_data *data)
+{
+	if (data->opts.strategy != STRATEGY_WAITER)
+		return ;
+	pthread_mutex_lock(&data->waiter.lock);
+	pthread_cond_broadcast(&data->waiter.seat_freed);
+	pthread_mutex_unlock(&data->waiter.lock);
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strategy_chandy.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:41:12 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 17:41:12 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function chandy_init
+ * @brief Distribue les fourchettes propres aux philosophes d'index pair.
+ *
+ * @param data: Pointeur vers les données partagées.
+ *
+ * @description Le mot futex 'state' de chaque fourchette vaut
+ * propriétaire * CHANDY_STATE_SHIFT, plus CHANDY_DIRTY si elle est sale
+ * et CHANDY_REQUESTED si le voisin l'attend. La fourchette f va au voisin
+ * pair f - f % 2 : le graphe de priorité alterne autour de la table, donc
+ * reste acyclique, et le premier tour est celui de --schedule=hunger.
+ * Sales au départ, elles seraient volées au fil de la création des
+ * threads et formeraient une chaîne d'attente faisant le tour de la table.
+ *
+ * @return SUCCESS.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples chandy_init(data);
+ *
+ * @dependencies Dépend de atomic_init.
+ *
+ * @control_flow 1. Pour chaque fourchette, la donner propre au voisin
+ *                  pair.
+ */
+int	chandy_init(t_data *data)
+{
+	int	f;
+
+	f = 0;
+	while (f < data->global_rules.n_philo)
+	{
+		atomic_init(&data->forks[f].state, (f - f % 2) * CHANDY_STATE_SHIFT);
+		f++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function chandy_request
+ * @brief Obtient une fourchette ou la réclame, sans attendre.
+ *
+ * @param philo: Le philosophe affamé.
+ * @param fork: La fourchette voulue.
+ *
+ * @description Une fourchette sale dont le propriétaire ne mange pas
+ * change de main et devient propre. Sinon CHANDY_REQUESTED est posé : le
+ * propriétaire la cèdera en reposant ses fourchettes.
+ *
+ * @return -1 si la fourchette est à lui, sinon la valeur du mot futex
+ * sur laquelle attendre.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples state = chandy_request(philo, &forks[left]);
+ *
+ * @dependencies Dépend de futex_wake_all.
+ *
+ * @control_flow 1. Déjà propriétaire : rien à faire.
+ *               2. Sale et libre : prise et réveil.
+ *               3. Sinon : demande marquée.
+ */
+int	chandy_request(t_philo *philo, t_fork *fork)
+{
+	int	state;
+	int	owner;
+
+	fork_lock(philo->shared_data, fork, NULL);
+	state = atomic_load_explicit(&fork->state, memory_order_relaxed);
+	owner = state / CHANDY_STATE_SHIFT;
+	if (owner != philo->id - 1 && state & CHANDY_DIRTY
+		&& !philo->shared_data->philo[owner].eating)
+	{
+		atomic_store_explicit(&fork->state,
+			(philo->id - 1) * CHANDY_STATE_SHIFT, memory_order_release);
+		futex_wake_all(&fork->state);
+		owner = philo->id - 1;
+	}
+	else if (owner != philo->id - 1)
+		atomic_store_explicit(&fork->state, state | CHANDY_REQUESTED,
+			memory_order_release);
+	fork_unlock(philo->shared_data, fork);
+	if (owner == philo->id - 1)
+		return (-1);
+	return (state | CHANDY_REQUESTED);
+}
+
+/**
+ * @function chandy_take
+ * @brief Stratégie Chandy/Misra : obtient les deux fourchettes et mange.
+ *
+ * @param philo: Le philosophe affamé.
+ *
+ * @description Les deux fourchettes sont réclamées ensemble : attendre
+ * la gauche avant de demander la droite formerait de longues chaînes
+ * d'attente sur les grandes tables. L'attente se fait sur le mot futex
+ * d'une fourchette manquante, bornée par CHANDY_POLL_US pour voir une
+ * mort. Aucun verrou n'est gardé pendant le repas : 'eating' interdit
+ * qu'on reprenne les fourchettes.
+ *
+ * @return SUCCESS une fois 'eating' posé, FAILURE si quelqu'un est mort.
+ *
+ * @errors/edge_effects Peut attendre les voisins.
+ *
+ * @examples if (strategy->take(philo))
+ *
+ * @dependencies Dépend de chandy_request, chandy_try_eat,
+ * futex_wait_until.
+ *
+ * @control_flow 1. Réclamer les deux fourchettes.
+ *               2. Les deux obtenues : tenter de manger.
+ *               3. Sinon attendre une fourchette manquante et recommencer.
+ */
+int	chandy_take(t_philo *philo)
+{
+	t_fork	*forks;
+	int		left;
+	int		right;
+	int		l_state;
+	int		r_state;
+
+	forks = philo->shared_data->forks;
+	left = philo->id - 1;
+	right = philo->id % philo->rules->n_philo;
+	while (1)
+	{
+		l_state = chandy_request(philo, &forks[left]);
+		r_state = chandy_request(philo, &forks[right]);
+		if (l_state < 0 && r_state < 0 && !chandy_try_eat(philo, left, right))
+			return (SUCCESS);
+		if (atomic_load_explicit(&philo->shared_data->someone_died,
+				memory_order_acquire))
+			return (FAILURE);
+		if (r_state >= 0)
+			futex_wait_until(&forks[right].state, r_state,
+				get_time(0) + CHANDY_POLL_US);
+		else if (l_state >= 0)
+			futex_wait_until(&forks[left].state, l_state,
+				get_time(0) + CHANDY_POLL_US);
+	}
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strategy_chandy_eat.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:58:03 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 17:58:03 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function chandy_try_eat
+ * @brief Vérifie sous les deux verrous que les deux fourchettes sont à lui.
+ *
+ * @param philo: Le philosophe affamé.
+ * @param left: Index de sa fourchette de gauche.
+ * @param right: Index de sa fourchette de droite.
+ *
+ * @description Une fourchette obtenue peut avoir été cédée entre-temps si
+ * elle était encore sale. Les verrous sont pris dans l'ordre des index ;
+ * 'eating' n'est écrit que sous les deux, ce qui suffit à un voisin qui
+ * le lit sous l'un d'eux.
+ *
+ * @return SUCCESS si le philosophe mange, FAILURE sinon.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples if (!chandy_try_eat(philo, left, right))
+ *
+ * @dependencies Dépend de fork_lock.
+ *
+ * @control_flow 1. Verrouiller les deux fourchettes.
+ *               2. Vérifier les propriétaires et marquer le repas.
+ */
+int	chandy_try_eat(t_philo *philo, int left, int right)
+{
+	t_fork	*forks;
+	int		owned;
+
+	forks = philo->shared_data->forks;
+	if (left > right)
+		return (chandy_try_eat(philo, right, left));
+	fork_lock(philo->shared_data, &forks[left], NULL);
+	fork_lock(philo->shared_data, &forks[right], NULL);
+	owned = atomic_load_explicit(&forks[left].state, memory_order_relaxed)
+		/ CHANDY_STATE_SHIFT == philo->id - 1
+		&& atomic_load_explicit(&forks[right].state, memory_order_relaxed)
+		/ CHANDY_STATE_SHIFT == philo->id - 1;
+	philo->eating = owned;
+	fork_unlock(philo->shared_data, &forks[right]);
+	fork_unlock(philo->shared_data, &forks[left]);
+	if (owned)
+		return (SUCCESS);
+	return (FAILURE);
+}
+
+/**
+ * @function chandy_hand_over
+ * @brief Salit une fourchette après le repas, ou la cède si demandée.
+ *
+ * @param philo: Le philosophe qui a mangé.
+ * @param f: Index de la fourchette, verrou tenu.
+ *
+ * @description Une fourchette demandée part propre chez le voisin : il
+ * sera servi avant que ce philosophe ne remange.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples chandy_hand_over(philo, left);
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Demandée : donner au voisin. Sinon : marquer sale.
+ */
+void	chandy_hand_over(t_philo *philo, int f)
+{
+	t_fork	*fork;
+	int		other;
+
+	fork = &philo->shared_data->forks[f];
+	other = f;
+	if (other == philo->id - 1)
+		other = (f - 1 + philo->rules->n_philo) % philo->rules->n_philo;
+	if (atomic_load_explicit(&fork->state, memory_order_relaxed)
+		& CHANDY_REQUESTED)
+		atomic_store_explicit(&fork->state, other * CHANDY_STATE_SHIFT,
+			memory_order_release);
+	else
+		atomic_store_explicit(&fork->state, (philo->id - 1)
+			* CHANDY_STATE_SHIFT + CHANDY_DIRTY, memory_order_release);
+}
+
+/**
+ * @function chandy_put
+ * @brief Termine le repas et libère les fourchettes.
+ *
+ * @param philo: Le philosophe qui a mangé.
+ *
+ * @description Sous les deux verrous, 'eating' retombe et chaque
+ * fourchette est cédée ou salie, puis les voisins sont réveillés.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples strategy->put(philo);
+ *
+ * @dependencies Dépend de chandy_hand_over et futex_wake_all.
+ *
+ * @control_flow 1. Verrouiller dans l'ordre des index.
+ *               2. Céder ou salir les deux fourchettes.
+ *               3. Réveiller les voisins.
+ */
+void	chandy_put(t_philo *philo)
+{
+	t_fork	*forks;
+	int		low;
+	int		high;
+
+	forks = philo->shared_data->forks;
+	low = philo->id - 1;
+	high = philo->id % philo->rules->n_philo;
+	if (low > high)
+	{
+		low = high;
+		high = philo->id - 1;
+	}
+	fork_lock(philo->shared_data, &forks[low], NULL);
+	fork_lock(philo->shared_data, &forks[high], NULL);
+	philo->eating = 0;
+	chandy_hand_over(philo, low);
+	chandy_hand_over(philo, high);
+	fork_unlock(philo->shared_data, &forks[high]);
+	fork_unlock(philo->shared_data, &forks[low]);
+	futex_wake_all(&forks[low].state);
+	futex_wake_all(&forks[high].state);
+}
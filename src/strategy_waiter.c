@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strategy_waiter.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:20:44 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 17:20:44 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        waiter_init
+ * @brief           Prépare le serveur : n - 1 places à table.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Avec au plus n - 1 philosophes cherchant leurs
+ *                  fourchettes, l'un d'eux obtient forcément les deux :
+ *                  aucun interblocage, quel que soit l'ordre de prise.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @side_effect     Initialisation d'un mutex et d'une condition.
+ * 
+ * @example         if (strategy->init && strategy->init(data))
+ * 
+ * @dependencies    pthread_mutex_init, pthread_cond_init
+ * 
+ * @control_flow    1. Nombre de places.
+ *                  2. Initialisation du verrou et de la condition.
+ */
+int	waiter_init(t_data *data)
+{
+	data->waiter.seats = data->global_rules.n_philo - 1;
+	if (pthread_mutex_init(&data->waiter.lock, NULL))
+		return (FAILURE);
+	if (pthread_cond_init(&data->waiter.seat_freed, NULL))
+		return (FAILURE);
+	return (SUCCESS);
+}
+
+/**
+ * @function        waiter_take
+ * @brief           Demande une place puis prend gauche puis droite.
+ * @param t_philo   *philo - Le philosophe.
+ * 
+ * @description     Tous prennent dans le même sens : c'est le serveur qui
+ *                  évite le cycle. Le voisin peut garder une fourchette
+ *                  tout un t_eat : chaque attente sort sur l'arrêt.
+ * 
+ * @return          SUCCESS : la place et les deux fourchettes sont tenues.
+ *                  FAILURE : l'arrêt a interrompu l'attente, ni place
+ *                  ni fourchette ne sont tenues.
+ * 
+ * @side_effect     Peut bloquer sur la condition puis sur les fourchettes.
+ * 
+ * @example         if (strategy->take(philo))
+ * 
+ * @dependencies    waiter_sit, fork_lock, fork_unlock, waiter_stand
+ * 
+ * @control_flow    1. Attente d'une place libre, sauf arrêt.
+ *                  2. Fourchette de gauche puis de droite, sauf arrêt.
+ *                  3. Sur arrêt, rendre la fourchette tenue et la place.
+ */
+int	waiter_take(t_philo *philo)
+{
+	t_data	*data;
+	int		left;
+	int		right;
+
+	data = philo->shared_data;
+	left = philo->id - 1;
+	right = philo->id % philo->rules->n_philo;
+	if (waiter_sit(data))
+		return (FAILURE);
+	if (!fork_lock(data, &data->forks[left], &data->someone_died))
+	{
+		if (!fork_lock(data, &data->forks[right], &data->someone_died))
+			return (SUCCESS);
+		fork_unlock(data, &data->forks[left]);
+	}
+	waiter_stand(data);
+	return (FAILURE);
+}
+
+/**
+ * @function        waiter_put
+ * @brief           Rend les fourchettes puis la place.
+ * @param t_philo   *philo - Le philosophe.
+ * 
+ * @description     La place libérée réveille un philosophe en attente.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Déverrouillage des fourchettes, signal de la condition.
+ * 
+ * @example         strategy->put(philo);
+ * 
+ * @dependencies    fork_unlock, waiter_stand
+ * 
+ * @control_flow    1. Fourchettes de droite puis de gauche.
+ *                  2. Restitution de la place.
+ */
+void	waiter_put(t_philo *philo)
+{
+	t_data	*data;
+
+	data = philo->shared_data;
+	fork_unlock(data, &data->forks[philo->id % philo->rules->n_philo]);
+	fork_unlock(data, &data->forks[philo->id - 1]);
+	waiter_stand(data);
+}
+
+/**
+ * @function        waiter_destroy
+ * @brief           Libère le verrou et la condition du serveur.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Appelée par cleanup_and_end avec --strategy=waiter.
+ * 
+ * @return          SUCCESS ou FAILURE.
+ * 
+ * @side_effect     Destruction d'un mutex et d'une condition.
+ * 
+ * @example         if (waiter_destroy(data))
+ * 
+ * @dependencies    pthread_mutex_destroy, pthread_cond_destroy
+ * 
+ * @control_flow    1. Destruction.
+ */
+int	waiter_destroy(t_data *data)
+{
+	if (pthread_mutex_destroy(&data->waiter.lock)
+		|| pthread_cond_destroy(&data->waiter.seat_freed))
+		return (FAILURE);
+	return (SUCCESS);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strategy_waiter_seat.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        waiter_sit
+ * @brief           Attend une place libre à table, sauf arrêt.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     someone_died est relu sous le verrou du serveur, et
+ *                  strategy_wake diffuse seat_freed sous ce même verrou
+ *                  après l'avoir publié : l'arrêt ne peut pas tomber
+ *                  entre la relecture et pthread_cond_wait.
+ * 
+ * @return          SUCCESS : une place est prise.
+ *                  FAILURE : l'arrêt a interrompu l'attente.
+ * 
+ * @side_effect     Peut bloquer sur la condition.
+ * 
+ * @example         if (waiter_sit(data))
+ * 
+ * @dependencies    pthread_mutex_lock, pthread_cond_wait
+ * 
+ * @control_flow    1. Attente d'une place ou de l'arrêt.
+ *                  2. Place prise s'il en reste une.
+ */
+int	waiter_sit(t_data *data)
+{
+	int	status;
+
+	status = FAILURE;
+	pthread_mutex_lock(&data->waiter.lock);
+	while (!data->waiter.seats && atomic_load_explicit(&data->someone_died,
+			memory_order_acquire) == NO_ONE_DIED)
+		pthread_cond_wait(&data->waiter.seat_freed, &data->waiter.lock);
+	if (data->waiter.seats)
+	{
+		data->waiter.seats--;
+		status = SUCCESS;
+	}
+	pthread_mutex_unlock(&data->waiter.lock);
+	return (status);
+}
+
+/**
+ * @function        waiter_stand
+ * @brief           Rend une place au serveur.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Appelée par waiter_put après le repas, et par
+ *                  waiter_take quand l'arrêt interrompt la prise des
+ *                  fourchettes : le compte des places reste juste.
+ * 
+ * @return          Aucun.
+ * 
+ * @side_effect     Signal de la condition.
+ * 
+ * @example         waiter_stand(data);
+ * 
+ * @dependencies    pthread_mutex_lock, pthread_cond_signal
+ * 
+ * @control_flow    1. Restitution de la place et réveil d'un attendant.
+ */
+void	waiter_stand(t_data *data)
+{
+	pthread_mutex_lock(&data->waiter.lock);
+	data->waiter.seats++;
+	pthread_cond_signal(&data->waiter.seat_freed);
+	pthread_mutex_unlock(&data->waiter.lock);
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_fork.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:55 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:55 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function acquire_task_fork
+ * @brief Prend une fourchette pour une tâche, sans bloquer l'ouvrier.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param task: La tâche qui veut la fourchette.
+ * @param i: Index de la fourchette.
+ *
+ * @description Le verrou de la fourchette ne protège que son état, jamais
+ * un repas. Si elle est prise, la tâche s'inscrit comme attendante : au
+ * relâchement, la fourchette lui est remise directement.
+ *
+ * @return int: 1 si la fourchette est acquise, 0 si la tâche est garée.
+ *
+ * @errors/edge_effects Une fourchette n'a que deux utilisateurs : un
+ * seul attendant possible.
+ *
+ * @examples if (!acquire_task_fork(data, task, task->first_fork))
+ *
+ * @dependencies Dépend de fork_lock, fork_unlock.
+ *
+ * @control_flow 1. Prendre la fourchette libre.
+ *               2. Sinon s'inscrire comme attendante.
+ */
+int	acquire_task_fork(t_data *data, t_task *task, int i)
+{
+	t_fork	*fork;
+
+	fork = &data->forks[i];
+	fork_lock(data, fork, NULL);
+	if (!fork->taken)
+	{
+		fork->taken = 1;
+		fork_unlock(data, fork);
+		return (1);
+	}
+	fork->waiter = task;
+	fork_unlock(data, fork);
+	return (0);
+}
+
+/**
+ * @function release_task_fork
+ * @brief Rend une fourchette, ou la remet à la tâche qui l'attend.
+ *
+ * @param worker: L'ouvrier qui exécute la tâche courante.
+ * @param i: Index de la fourchette.
+ *
+ * @description La tâche attendante reçoit la fourchette encore prise et
+ * rejoint la file locale de l'ouvrier. Si c'était sa seconde fourchette,
+ * l'instant de la remise est noté pour l'histogramme fork_to_eat.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples release_task_fork(worker, task->second_fork);
+ *
+ * @dependencies Dépend de push_task.
+ *
+ * @control_flow 1. Retirer l'attendant éventuel.
+ *               2. Libérer la fourchette s'il n'y en a pas.
+ *               3. Réveiller l'attendant.
+ */
+void	release_task_fork(t_worker *worker, int i)
+{
+	t_fork	*fork;
+	t_task	*waiter;
+
+	fork = &worker->data->forks[i];
+	fork_lock(worker->data, fork, NULL);
+	waiter = fork->waiter;
+	fork->waiter = NULL;
+	if (!waiter)
+		fork->taken = 0;
+	fork_unlock(worker->data, fork);
+	if (!waiter)
+		return ;
+	if (HISTO_ENABLED && waiter->state == TASK_EAT)
+		waiter->forks_at = get_time(worker->data->t0);
+	push_task(worker, waiter);
+}
+
+/**
+ * @function take_task_forks
+ * @brief Étape "prendre les fourchettes" de la machine à états.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ * @param task: La tâche courante.
+ *
+ * @description Même ordre pair/impair que le mode threads. L'état est
+ * avancé avant chaque tentative : une tâche garée reprend exactement
+ * après la fourchette qui lui a été remise.
+ *
+ * @return int: TASK_CONTINUE ou TASK_PARKED.
+ *
+ * @errors/edge_effects Un philosophe seul ne mange jamais : il passe
+ * directement au sommeil.
+ *
+ * @examples return (take_task_forks(worker->data, task));
+ *
+ * @dependencies Dépend de acquire_task_fork.
+ *
+ * @control_flow 1. Cas du philosophe seul.
+ *               2. Prise de la première fourchette.
+ *               3. Prise de la seconde fourchette.
+ */
+int	take_task_forks(t_data *data, t_task *task)
+{
+	if (task->philo->rules->n_philo == ALONE)
+	{
+		task->state = TASK_SLEEP;
+		return (TASK_CONTINUE);
+	}
+	if (task->state == TASK_TAKE_FIRST)
+	{
+		note_hungry(task->philo);
+		task->state = TASK_TAKE_SECOND;
+		if (!acquire_task_fork(data, task, task->first_fork))
+			return (TASK_PARKED);
+	}
+	task->state = TASK_EAT;
+	if (!acquire_task_fork(data, task, task->second_fork))
+		return (TASK_PARKED);
+	if (HISTO_ENABLED)
+		task->forks_at = table_now(data);
+	return (TASK_CONTINUE);
+}
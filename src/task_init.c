@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_init.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:10:42 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 15:10:42 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function init_tasks
+ * @brief Crée une tâche par philosophe.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Chaque tâche démarre à TASK_START et mémorise l'ordre de
+ * ses fourchettes. Partagée par le mode tâches et la simulation ; sans
+ * ouvriers, la table des ouvriers reste vide.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Arène épuisée.
+ *
+ * @examples if (init_tasks(data))
+ *
+ * @dependencies Dépend de arena_alloc et get_fork_order.
+ *
+ * @control_flow 1. Allocation des tâches.
+ *               2. Initialisation de chaque tâche.
+ */
+int	init_tasks(t_data *data)
+{
+	t_sched	*sched;
+	int		i;
+
+	sched = &data->sched;
+	sched->workers = NULL;
+	sched->n_workers = 0;
+	sched->tasks = arena_alloc(data, sizeof(t_task)
+			* data->global_rules.n_philo);
+	if (!sched->tasks)
+		return (FAILURE);
+	i = -1;
+	while (++i < data->global_rules.n_philo)
+	{
+		sched->tasks[i].next = NULL;
+		sched->tasks[i].philo = &data->philo[i];
+		sched->tasks[i].state = TASK_START;
+		get_fork_order(&data->philo[i], &sched->tasks[i].first_fork,
+			&sched->tasks[i].second_fork);
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function init_workers
+ * @brief Initialise les ouvriers et leurs tas de minuteries.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Chaque ouvrier a sa file, son verrou et un tas de
+ * minuteries assez grand pour accueillir toutes les tâches.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Arène épuisée ou échec d'initialisation du
+ * verrou.
+ *
+ * @examples if (init_workers(data))
+ *
+ * @dependencies Dépend de arena_alloc et pthread_mutex_init.
+ *
+ * @control_flow 1. Initialisation de chaque ouvrier.
+ */
+int	init_workers(t_data *data)
+{
+	t_worker	*worker;
+	int			i;
+
+	i = 0;
+	while (i < data->sched.n_workers)
+	{
+		worker = &data->sched.workers[i];
+		worker->head = NULL;
+		worker->tail = NULL;
+		worker->id = i;
+		worker->switches = 0;
+		worker->data = data;
+		worker->timers.size = 0;
+		worker->timers.nodes = arena_alloc(data, sizeof(t_deadline)
+				* data->global_rules.n_philo);
+		if (!worker->timers.nodes || pthread_mutex_init(&worker->lock, NULL))
+			return (FAILURE);
+		i++;
+	}
+	return (SUCCESS);
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_sched.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:31:07 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 14:31:07 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function init_task_scheduler
+ * @brief Prépare le mode tâches : une tâche par philosophe.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Le nombre d'ouvriers est borné par le nombre de
+ * philosophes.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Arène épuisée.
+ *
+ * @examples if (data->opts.mode == MODE_TASKS && init_task_scheduler(data))
+ *
+ * @dependencies Dépend de arena_alloc, init_tasks et init_workers.
+ *
+ * @control_flow 1. Initialisation des tâches.
+ *               2. Allocation et initialisation des ouvriers.
+ */
+int	init_task_scheduler(t_data *data)
+{
+	t_sched	*sched;
+
+	if (init_tasks(data))
+		return (FAILURE);
+	sched = &data->sched;
+	sched->n_workers = data->opts.n_workers;
+	if (sched->n_workers > data->global_rules.n_philo)
+		sched->n_workers = data->global_rules.n_philo;
+	sched->workers = arena_alloc(data, sizeof(t_worker) * sched->n_workers);
+	if (!sched->workers)
+		return (FAILURE);
+	return (init_workers(data));
+}
+
+/**
+ * @function start_task_scheduler
+ * @brief Distribue les tâches et lance les ouvriers.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Les tâches sont réparties à tour de rôle : deux voisins
+ * tombent sur des ouvriers différents dès qu'il y en a plusieurs.
+ *
+ * @return int: SUCCESS ou FAILURE_CREAT_THREADS.
+ *
+ * @errors/edge_effects Échec de pthread_create.
+ *
+ * @examples if (start_task_scheduler(data))
+ *
+ * @dependencies Dépend de push_task et pthread_create.
+ *
+ * @control_flow 1. Répartition des tâches.
+ *               2. Lancement des ouvriers.
+ */
+int	start_task_scheduler(t_data *data)
+{
+	t_sched	*sched;
+	int		i;
+
+	sched = &data->sched;
+	i = 0;
+	while (i < data->global_rules.n_philo)
+	{
+		push_task(&sched->workers[i % sched->n_workers], &sched->tasks[i]);
+		i++;
+	}
+	atomic_store_explicit(&sched->active, data->global_rules.n_philo,
+		memory_order_release);
+	i = 0;
+	while (i < sched->n_workers)
+	{
+		if (pthread_create(&sched->workers[i].thread, NULL,
+				&run_task_worker, &sched->workers[i]))
+			return (FAILURE_CREAT_THREADS);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function join_task_scheduler
+ * @brief Attend la fin des ouvriers.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Les ouvriers s'arrêtent seuls après une mort ou quand
+ * toutes les tâches ont terminé.
+ *
+ * @return int: SUCCESS ou FAILURE_JOIN_THREADS.
+ *
+ * @errors/edge_effects Échec de pthread_join.
+ *
+ * @examples if (join_task_scheduler(data))
+ *
+ * @dependencies Dépend de pthread_join.
+ *
+ * @control_flow 1. Jointure de chaque ouvrier.
+ */
+int	join_task_scheduler(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->sched.n_workers)
+	{
+		if (pthread_join(data->sched.workers[i].thread, NULL))
+			return (FAILURE_JOIN_THREADS);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function destroy_task_scheduler
+ * @brief Détruit les verrous des ouvriers.
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Appelée par cleanup_and_end en mode tâches comme en mode
+ * simulation, où il n'y a aucun ouvrier. Ouvriers, minuteries et
+ * tâches vivent dans l'arène et partent avec elle.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples destroy_task_scheduler(data);
+ *
+ * @dependencies Dépend de pthread_mutex_destroy.
+ *
+ * @control_flow 1. Destruction de chaque ouvrier.
+ */
+void	destroy_task_scheduler(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->sched.n_workers)
+	{
+		pthread_mutex_destroy(&data->sched.workers[i].lock);
+		i++;
+	}
+}
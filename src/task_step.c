@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_step.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:55 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:55 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function eat_task
+ * @brief Étape "manger" de la machine à états.
+ *
+ * @param worker: L'ouvrier qui exécute la tâche.
+ * @param task: La tâche courante, qui tient ses deux fourchettes.
+ *
+ * @description Journalise le repas et arme la minuterie de t_eat. Comme
+ * en mode threads, fork_to_eat mesure l'attente entre les fourchettes
+ * tenues et le début du repas.
+ *
+ * @return int: TASK_PARKED.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples return (eat_task(worker, task));
+ *
+ * @dependencies Dépend de start_meal, histo_record et arm_task_timer.
+ *
+ * @control_flow 1. Début du repas.
+ *               2. Mesure éventuelle de l'attente.
+ *               3. Minuterie de fin de repas.
+ */
+int	eat_task(t_worker *worker, t_task *task)
+{
+	start_meal(task->philo);
+	if (HISTO_ENABLED)
+		histo_record(&worker->data->histos.fork_to_eat,
+			task->philo->last_meal - task->forks_at);
+	task->state = TASK_DONE_EATING;
+	return (arm_task_timer(worker, task, task->philo->rules->t_eat));
+}
+
+/**
+ * @function rest_task
+ * @brief Étapes "manger", "dormir" et "penser" de la machine à états.
+ *
+ * @param worker: L'ouvrier qui exécute la tâche.
+ * @param task: La tâche courante.
+ *
+ * @description Chaque attente arme une minuterie sur l'ouvrier au lieu
+ * de dormir : la tâche est reprise à l'état suivant à son échéance.
+ *
+ * @return int: TASK_PARKED.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples return (rest_task(worker, task));
+ *
+ * @dependencies Dépend de eat_task, finish_meal, release_task_fork,
+ * log_action et arm_task_timer.
+ *
+ * @control_flow 1. Sélection de l'état.
+ *               2. Action puis armement de la minuterie.
+ */
+int	rest_task(t_worker *worker, t_task *task)
+{
+	const t_rules	*rules;
+
+	rules = task->philo->rules;
+	if (task->state == TASK_EAT)
+		return (eat_task(worker, task));
+	if (task->state == TASK_DONE_EATING)
+	{
+		finish_meal(task->philo);
+		release_task_fork(worker, task->second_fork);
+		release_task_fork(worker, task->first_fork);
+		task->state = TASK_SLEEP;
+	}
+	if (task->state == TASK_SLEEP)
+	{
+		log_action(task->philo, LOG_EV_SLEEPING);
+		task->state = TASK_THINK;
+		return (arm_task_timer(worker, task, rules->t_sleep));
+	}
+	log_action(task->philo, LOG_EV_THINKING);
+	task->state = TASK_CHECK;
+	return (arm_task_timer(worker, task, rules->t_think));
+}
+
+/**
+ * @function advance_task
+ * @brief Exécute un état de la machine à états d'un philosophe.
+ *
+ * @param worker: L'ouvrier qui exécute la tâche.
+ * @param task: La tâche courante.
+ *
+ * @description Reproduit run_philosopher_routine : décalage des
+ * impairs, fourchettes, repas, sommeil, réflexion puis vérification.
+ *
+ * @return int: TASK_CONTINUE, TASK_PARKED ou TASK_DONE.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples status = advance_task(worker, task);
+ *
+ * @dependencies Dépend de take_task_forks, rest_task et arm_task_timer.
+ *
+ * @control_flow 1. Décalage initial des philosophes impairs.
+ *               2. Prise des fourchettes.
+ *               3. Repas, sommeil et réflexion.
+ *               4. Fin de la tâche ou nouveau cycle.
+ */
+int	advance_task(t_worker *worker, t_task *task)
+{
+	if (task->state == TASK_START)
+	{
+		task->state = TASK_TAKE_FIRST;
+		if (task->philo->id % 2)
+			return (arm_task_timer(worker, task,
+					task->philo->rules->t_eat / US_TO_MS));
+	}
+	if (task->state == TASK_TAKE_FIRST || task->state == TASK_TAKE_SECOND)
+		return (take_task_forks(worker->data, task));
+	if (task->state != TASK_CHECK)
+		return (rest_task(worker, task));
+	if (should_philo_continue(worker->data, task->philo))
+		return (TASK_DONE);
+	task->state = TASK_TAKE_FIRST;
+	return (TASK_CONTINUE);
+}
+
+/**
+ * @function run_task_step
+ * @brief Fait avancer une tâche jusqu'à sa prochaine attente.
+ *
+ * @param worker: L'ouvrier qui exécute la tâche.
+ * @param task: La tâche à reprendre.
+ *
+ * @description Enchaîne les états tant qu'aucune attente n'est requise.
+ * Une tâche terminée décrémente le nombre de tâches actives.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Après une mort, la tâche n'est plus reprogrammée.
+ *
+ * @examples run_task_step(worker, task);
+ *
+ * @dependencies Dépend de advance_task.
+ *
+ * @control_flow 1. Avancer tant que TASK_CONTINUE.
+ *               2. Décompter la tâche si elle est terminée.
+ */
+void	run_task_step(t_worker *worker, t_task *task)
+{
+	int	status;
+
+	status = TASK_CONTINUE;
+	while (status == TASK_CONTINUE
+		&& !atomic_load_explicit(&worker->data->someone_died,
+			memory_order_acquire))
+		status = advance_task(worker, task);
+	if (status == TASK_DONE)
+		atomic_fetch_sub_explicit(&worker->data->sched.active, 1,
+			memory_order_release);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_timer.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:20:31 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 14:20:31 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function arm_task_timer
+ * @brief Gare une tâche jusqu'à la fin d'une attente.
+ *
+ * @param worker: L'ouvrier qui exécute la tâche.
+ * @param task: La tâche à garer.
+ * @param duration: Durée de l'attente en microsecondes.
+ *
+ * @description Remplace ft_usleep du mode threads : au lieu de bloquer
+ * un thread, la tâche est rangée dans le tas de minuteries de l'ouvrier
+ * et l'ouvrier passe à la tâche suivante.
+ *
+ * @return int: TASK_PARKED.
+ *
+ * @errors/edge_effects Le tas d'un ouvrier peut contenir toutes les
+ * tâches : il est dimensionné à n_philo. Une durée négative (t_think
+ * quand t_die est court) ne fait pas attendre, comme ft_usleep.
+ *
+ * @examples return (arm_task_timer(worker, task, rules->t_sleep));
+ *
+ * @dependencies Dépend de get_time et deadline_heap_push.
+ *
+ * @control_flow 1. Calcul de l'échéance absolue.
+ *               2. Insertion dans le tas de l'ouvrier.
+ */
+int	arm_task_timer(t_worker *worker, t_task *task, long duration)
+{
+	t_data	*data;
+
+	data = worker->data;
+	if (duration < 0)
+		duration = 0;
+	deadline_heap_push(&worker->timers, get_time(data->t0) + duration,
+		task - data->sched.tasks);
+	return (TASK_PARKED);
+}
+
+/**
+ * @function release_due_timers
+ * @brief Remet en file les tâches dont l'attente est écoulée.
+ *
+ * @param worker: L'ouvrier propriétaire des minuteries.
+ * @param now: Temps courant depuis t0, en microsecondes.
+ *
+ * @description Seul l'ouvrier propriétaire touche à son tas : aucun
+ * verrou n'est nécessaire. Avec PHILO_HISTO, le retard de chaque
+ * minuterie compte comme un retard de ft_usleep.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples release_due_timers(worker, get_time(data->t0));
+ *
+ * @dependencies Dépend de deadline_heap_pop et push_task.
+ *
+ * @control_flow 1. Tant que la plus proche échéance est passée :
+ *                  retirer la minuterie et remettre la tâche en file.
+ */
+void	release_due_timers(t_worker *worker, long now)
+{
+	t_deadline_heap	*timers;
+	int				index;
+
+	timers = &worker->timers;
+	while (timers->size && timers->nodes[0].deadline <= now)
+	{
+		index = timers->nodes[0].index;
+		if (HISTO_ENABLED)
+			histo_record(&worker->data->histos.sleep,
+				now - timers->nodes[0].deadline);
+		deadline_heap_pop(timers);
+		push_task(worker, &worker->data->sched.tasks[index]);
+	}
+}
@@ -0,0 +1,202 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_worker.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:20:31 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 14:20:31 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function push_task
+ * @brief Ajoute une tâche prête en fin de file d'un ouvrier.
+ *
+ * @param worker: L'ouvrier destinataire.
+ * @param task: La tâche à ajouter.
+ *
+ * @description File FIFO protégée par le verrou de l'ouvrier, car les
+ * autres ouvriers peuvent venir y voler du travail.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples push_task(worker, waiter);
+ *
+ * @dependencies Dépend de pthread_mutex_lock, pthread_mutex_unlock.
+ *
+ * @control_flow 1. Chaînage en fin de file sous le verrou.
+ */
+void	push_task(t_worker *worker, t_task *task)
+{
+	task->next = NULL;
+	pthread_mutex_lock(&worker->lock);
+	if (worker->tail)
+		worker->tail->next = task;
+	else
+		worker->head = task;
+	worker->tail = task;
+	pthread_mutex_unlock(&worker->lock);
+}
+
+/**
+ * @function pop_task
+ * @brief Retire la tâche en tête de file d'un ouvrier.
+ *
+ * @param worker: L'ouvrier dont la file est consultée.
+ *
+ * @description Utilisée par l'ouvrier sur sa propre file comme par les
+ * voleurs sur celle des autres.
+ *
+ * @return t_task*: La tâche retirée, ou NULL si la file est vide.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples task = pop_task(worker);
+ *
+ * @dependencies Dépend de pthread_mutex_lock, pthread_mutex_unlock.
+ *
+ * @control_flow 1. Décrochage de la tête sous le verrou.
+ */
+t_task	*pop_task(t_worker *worker)
+{
+	t_task	*task;
+
+	pthread_mutex_lock(&worker->lock);
+	task = worker->head;
+	if (task)
+	{
+		worker->head = task->next;
+		if (!worker->head)
+			worker->tail = NULL;
+	}
+	pthread_mutex_unlock(&worker->lock);
+	return (task);
+}
+
+/**
+ * @function steal_task
+ * @brief Vole une tâche prête à un autre ouvrier.
+ *
+ * @param worker: L'ouvrier inoccupé.
+ *
+ * @description Parcourt les autres ouvriers à partir du voisin suivant
+ * pour répartir les vols.
+ *
+ * @return t_task*: La tâche volée, ou NULL si toutes les files sont vides.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples task = steal_task(worker);
+ *
+ * @dependencies Dépend de pop_task.
+ *
+ * @control_flow 1. Essai de chaque autre ouvrier tour à tour.
+ */
+t_task	*steal_task(t_worker *worker)
+{
+	t_sched	*sched;
+	t_task	*task;
+	int		i;
+
+	sched = &worker->data->sched;
+	i = 1;
+	while (i < sched->n_workers)
+	{
+		task = pop_task(&sched->workers[(worker->id + i) % sched->n_workers]);
+		if (task)
+			return (task);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @function wait_for_work
+ * @brief Endort un ouvrier sans travail prêt.
+ *
+ * @param worker: L'ouvrier inoccupé.
+ *
+ * @description Dort jusqu'à la prochaine minuterie avec sleep_until pour
+ * garder la précision du mode threads : une tâche prête naît toujours
+ * chez l'ouvrier qui l'a débloquée, rien ne justifie de se réveiller
+ * avant. Sans minuterie, attend au plus WORKER_IDLE_US avant de retenter
+ * un vol. Une mort réveille l'ouvrier.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples wait_for_work(worker);
+ *
+ * @dependencies Dépend de sleep_until et futex_wait_until.
+ *
+ * @control_flow 1. Minuterie armée : sleep_until.
+ *               2. Sinon attente bornée sur le futex someone_died.
+ */
+void	wait_for_work(t_worker *worker)
+{
+	t_data	*data;
+
+	data = worker->data;
+	if (worker->timers.size)
+		sleep_until(data, data->t0 + worker->timers.nodes[0].deadline);
+	else
+		futex_wait_until(&data->someone_died, NO_ONE_DIED,
+			get_time(0) + WORKER_IDLE_US);
+}
+
+/**
+ * @function run_task_worker
+ * @brief Boucle d'un ouvrier du mode tâches.
+ *
+ * @param valise: Pointeur vers le t_worker.
+ *
+ * @description Réveille les minuteries échues, exécute une tâche locale
+ * ou volée, sinon dort. S'arrête à la première mort ou quand toutes les
+ * tâches ont terminé leurs repas.
+ *
+ * @return void*: NULL.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples pthread_create(&worker->thread, NULL, &run_task_worker, worker);
+ *
+ * @dependencies Dépend de release_due_timers, pop_task, steal_task,
+ * run_task_step et wait_for_work.
+ *
+ * @control_flow 1. Boucle tant que personne n'est mort et qu'il reste
+ *                  des tâches actives.
+ *               2. Exécution ou attente.
+ */
+void	*run_task_worker(void *valise)
+{
+	t_worker	*worker;
+	t_data		*data;
+	t_task		*task;
+
+	worker = (t_worker *) valise;
+	data = worker->data;
+	affinity_pin(data, pthread_self(), worker->id, data->sched.n_workers);
+	while (!atomic_load_explicit(&data->someone_died, memory_order_acquire)
+		&& atomic_load_explicit(&data->sched.active, memory_order_acquire))
+	{
+		release_due_timers(worker, get_time(data->t0));
+		task = pop_task(worker);
+		if (!task)
+			task = steal_task(worker);
+		if (task)
+		{
+			worker->switches++;
+			run_task_step(worker, task);
+		}
+		else
+			wait_for_work(worker);
+	}
+	return (NULL);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   threads.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:48:02 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 13:48:02 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function        join_philosopher_threads
+ * @brief           Rejoint les threads des philosophes.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Attend la fin de chaque thread de philosophe.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE_JOIN_THREADS.
+ * 
+ * @side_effect     Terminaison de threads.
+ * 
+ * @example         if (join_philosopher_threads(data))
+ * 
+ * @dependencies    pthread_join
+ * 
+ * @control_flow    1. Jointure des threads un par un.
+ */
+int	join_philosopher_threads(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->global_rules.n_philo)
+	{
+		if (pthread_join(data->thread_ids[i], NULL))
+			return (FAILURE_JOIN_THREADS);
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        start_philosophers
+ * @brief           Lance les philosophes selon le mode choisi.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Un thread chacun, des tâches réparties sur les
+ *                  ouvriers avec --tasks, ou des partitions contiguës
+ *                  dans des processus ouvriers avec --processes.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE_CREAT_THREADS.
+ * 
+ * @side_effect     Création de threads ou de processus.
+ * 
+ * @example         error = start_philosophers(data);
+ * 
+ * @dependencies    start_task_scheduler, start_partitions,
+ *                  create_philosopher_threads
+ * 
+ * @control_flow    1. Choix selon le mode.
+ */
+int	start_philosophers(t_data *data)
+{
+	if (data->opts.mode == MODE_TASKS)
+		return (start_task_scheduler(data));
+	if (data->opts.n_procs > 1)
+		return (start_partitions(data));
+	return (create_philosopher_threads(data));
+}
+
+/**
+ * @function        join_philosophers
+ * @brief           Attend la fin des philosophes selon le mode choisi.
+ * @param t_data    *data - Pointeur vers les données partagées.
+ * 
+ * @description     Pendant de start_philosophers.
+ * 
+ * @return          Retourne SUCCESS ou FAILURE_JOIN_THREADS.
+ * 
+ * @side_effect     Terminaison de threads ou de processus.
+ * 
+ * @example         error = join_philosophers(data);
+ * 
+ * @dependencies    join_task_scheduler, join_partitions,
+ *                  join_philosopher_threads
+ * 
+ * @control_flow    1. Choix selon le mode.
+ */
+int	join_philosophers(t_data *data)
+{
+	if (data->opts.mode == MODE_TASKS)
+		return (join_task_scheduler(data));
+	if (data->opts.n_procs > 1)
+		return (join_partitions(data));
+	return (join_philosopher_threads(data));
+}
@@ -0,0 +1,224 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   topology.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:24:33 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 21:24:33 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function read_topology
+ * @brief Lit un identifiant de topologie d'un CPU dans sysfs.
+ *
+ * @param cpu: Numéro du CPU.
+ * @param file: Chemin relatif à /sys/devices/system/cpu/cpuN.
+ *
+ * @description Lit un entier décimal, par exemple
+ * topology/physical_package_id ou cache/index3/id.
+ *
+ * @return long: L'identifiant, ou 0 si le fichier est absent.
+ *
+ * @errors/edge_effects Un conteneur sans sysfs voit tous ses CPU dans le
+ * même paquet, le même LLC et sur le même cœur : l'ordre devient celui
+ * des numéros.
+ *
+ * @examples package = read_topology(3, TOPO_PACKAGE);
+ *
+ * @dependencies Dépend de snprintf, open, read, close et ft_atol.
+ *
+ * @control_flow 1. Construire le chemin.
+ *               2. Lire et convertir la valeur.
+ */
+long	read_topology(int cpu, const char *file)
+{
+	char	path[TOPO_PATH_SIZE];
+	char	value[TOPO_VALUE_SIZE];
+	ssize_t	len;
+	int		fd;
+
+	snprintf(path, TOPO_PATH_SIZE, TOPO_SYSFS, cpu, file);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	len = read(fd, value, TOPO_VALUE_SIZE - 1);
+	close(fd);
+	if (len <= 0)
+		return (0);
+	value[len] = '\0';
+	if (value[len - 1] == '\n')
+		value[len - 1] = '\0';
+	return (ft_atol(value));
+}
+
+/**
+ * @function topology_key
+ * @brief Clé de tri d'un CPU : paquet, LLC, cœur puis numéro.
+ *
+ * @param cpu: Numéro du CPU.
+ *
+ * @description Deux CPU voisins dans l'ordre de cette clé partagent
+ * d'abord un cœur (SMT), sinon un LLC, sinon un paquet. Chaque champ
+ * occupe TOPO_SPAN valeurs.
+ *
+ * @return long: La clé.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples keys[i] = topology_key(cpus[i]);
+ *
+ * @dependencies Dépend de read_topology.
+ *
+ * @control_flow 1. Composer paquet, LLC, cœur et numéro.
+ */
+long	topology_key(int cpu)
+{
+	long	key;
+
+	key = read_topology(cpu, TOPO_PACKAGE);
+	key = key * TOPO_SPAN + read_topology(cpu, TOPO_LLC);
+	key = key * TOPO_SPAN + read_topology(cpu, TOPO_CORE);
+	return (key * TOPO_SPAN + cpu);
+}
+
+/**
+ * @function sort_cpus
+ * @brief Trie les CPU selon leur clé de topologie.
+ *
+ * @param cpus: Numéros des CPU.
+ * @param keys: Clés correspondantes, triées avec eux.
+ * @param n: Nombre de CPU.
+ *
+ * @description Tri par insertion : quelques centaines de CPU au plus,
+ * une seule fois au démarrage.
+ *
+ * @return void
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples sort_cpus(cpus, keys, n);
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Insérer chaque CPU à sa place.
+ */
+void	sort_cpus(int *cpus, long *keys, int n)
+{
+	int		i;
+	int		j;
+	int		cpu;
+	long	key;
+
+	i = 1;
+	while (i < n)
+	{
+		cpu = cpus[i];
+		key = keys[i];
+		j = i - 1;
+		while (j >= 0 && keys[j] > key)
+		{
+			cpus[j + 1] = cpus[j];
+			keys[j + 1] = keys[j];
+			j--;
+		}
+		cpus[j + 1] = cpu;
+		keys[j + 1] = key;
+		i++;
+	}
+}
+
+/**
+ * @function list_cpus
+ * @brief Liste les CPU d'un ensemble avec leur clé de topologie.
+ *
+ * @param set: Ensemble des CPU autorisés.
+ * @param cpus: Reçoit les numéros.
+ * @param keys: Reçoit les clés.
+ *
+ * @description Parcourt l'ensemble dans l'ordre des numéros.
+ *
+ * @return int: Nombre de CPU listés.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples n = list_cpus(&set, cpus, keys);
+ *
+ * @dependencies Dépend de CPU_ISSET et topology_key.
+ *
+ * @control_flow 1. Parcourir les CPU possibles.
+ *               2. Garder ceux de l'ensemble.
+ */
+int	list_cpus(cpu_set_t *set, int *cpus, long *keys)
+{
+	int	cpu;
+	int	n;
+
+	n = 0;
+	cpu = 0;
+	while (cpu < CPU_SETSIZE)
+	{
+		if (CPU_ISSET(cpu, set))
+		{
+			cpus[n] = cpu;
+			keys[n++] = topology_key(cpu);
+		}
+		cpu++;
+	}
+	return (n);
+}
+
+/**
+ * @function init_affinity
+ * @brief Ordonne les CPU autorisés selon la topologie (--affinity).
+ *
+ * @param data: Pointeur vers la structure t_data.
+ *
+ * @description Prend les CPU de sched_getaffinity et les trie par
+ * topology_key. Les derniers, AFFINITY_RESERVED au plus et jamais plus
+ * de la moitié, sont réservés au moniteur et au thread de vidage ; les
+ * places se partagent le reste, en blocs contigus. Sans --affinity, ne
+ * fait rien.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects Avec un seul CPU, rien n'est réservé.
+ *
+ * @examples if (init_affinity(data))
+ *
+ * @dependencies Dépend de sched_getaffinity, malloc, list_cpus et
+ * sort_cpus.
+ *
+ * @control_flow 1. Lister les CPU autorisés et leur clé.
+ *               2. Les trier.
+ *               3. Fixer le nombre de CPU réservés.
+ */
+int	init_affinity(t_data *data)
+{
+	cpu_set_t	set;
+	long		*keys;
+
+	data->affinity.cpus = NULL;
+	if (!data->opts.affinity)
+		return (SUCCESS);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &set))
+		return (FAILURE);
+	data->affinity.cpus = malloc(sizeof(int) * CPU_COUNT(&set));
+	keys = malloc(sizeof(long) * CPU_COUNT(&set));
+	if (!data->affinity.cpus || !keys)
+	{
+		free(keys);
+		return (FAILURE);
+	}
+	data->affinity.n_cpus = list_cpus(&set, data->affinity.cpus, keys);
+	sort_cpus(data->affinity.cpus, keys, data->affinity.n_cpus);
+	free(keys);
+	data->affinity.reserved = data->affinity.n_cpus / 2;
+	if (data->affinity.reserved > AFFINITY_RESERVED)
+		data->affinity.reserved = AFFINITY_RESERVED;
+	return (SUCCESS);
+}
@@ -0,0 +1,221 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:41:52 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 23:41:52 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../inc/philo.h"
+
+/**
+ * @function trace_open
+ * @brief Crée le fichier de --trace et y écrit son en-tête.
+ *
+ * @param trace: Pointeur vers la structure t_trace.
+ * @param path: Chemin du fichier, tronqué s'il existe.
+ *
+ * @description Le fichier commence par TRACE_MAGIC, suivi des
+ * enregistrements. Le premier horodatage est encodé par rapport à 0.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects FAILURE si le fichier ne peut être créé ou
+ * projeté ; fd reste alors TRACE_CLOSED.
+ *
+ * @examples if (trace && trace_open(&log->trace, trace))
+ *
+ * @dependencies Dépend de open et trace_map.
+ *
+ * @control_flow 1. Créer le fichier.
+ *               2. Projeter la première fenêtre.
+ *               3. Écrire l'en-tête.
+ */
+int	trace_open(t_trace *trace, const char *path)
+{
+	trace->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, TRACE_MODE);
+	if (trace->fd < 0)
+	{
+		trace->fd = TRACE_CLOSED;
+		return (FAILURE);
+	}
+	trace->window = NULL;
+	trace->offset = 0;
+	trace->used = 0;
+	trace->last = 0;
+	if (trace_map(trace))
+	{
+		close(trace->fd);
+		trace->fd = TRACE_CLOSED;
+		return (FAILURE);
+	}
+	memcpy(trace->window, TRACE_MAGIC, TRACE_MAGIC_LEN);
+	trace->used = TRACE_MAGIC_LEN;
+	return (SUCCESS);
+}
+
+/**
+ * @function trace_map
+ * @brief Fait glisser la fenêtre projetée sur la fin du fichier.
+ *
+ * @param trace: Pointeur vers la structure t_trace.
+ *
+ * @description Le fichier ne fait que grandir : la fenêtre avance des
+ * blocs de TRACE_ALIGN déjà remplis, garde le bloc entamé, et le
+ * fichier est allongé jusqu'à sa nouvelle fin. Rien n'est copié, les
+ * octets écrits restent dans le cache de pages du fichier.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects FAILURE si ftruncate ou mmap échoue ; window
+ * vaut alors NULL.
+ *
+ * @examples if (trace_map(trace))
+ *
+ * @dependencies Dépend de munmap, ftruncate et mmap.
+ *
+ * @control_flow 1. Retirer l'ancienne fenêtre.
+ *               2. Avancer des blocs pleins.
+ *               3. Allonger le fichier et projeter.
+ */
+int	trace_map(t_trace *trace)
+{
+	void	*window;
+
+	if (trace->window)
+		munmap(trace->window, TRACE_WINDOW);
+	trace->window = NULL;
+	trace->offset += trace->used & ~((size_t)TRACE_ALIGN - 1);
+	trace->used &= TRACE_ALIGN - 1;
+	if (ftruncate(trace->fd, trace->offset + TRACE_WINDOW))
+		return (FAILURE);
+	window = mmap(NULL, TRACE_WINDOW, PROT_READ | PROT_WRITE, MAP_SHARED,
+			trace->fd, trace->offset);
+	if (window == MAP_FAILED)
+		return (FAILURE);
+	trace->window = window;
+	return (SUCCESS);
+}
+
+/**
+ * @function trace_varint
+ * @brief Encode un entier en LEB128, 7 bits par octet.
+ *
+ * @param out: Tampon d'au moins 10 octets.
+ * @param value: Valeur à encoder.
+ *
+ * @description Le bit de poids fort de chaque octet annonce une suite.
+ * Les petites valeurs, de loin les plus fréquentes, tiennent en un
+ * octet.
+ *
+ * @return size_t: Nombre d'octets écrits.
+ *
+ * @errors/edge_effects Aucun.
+ *
+ * @examples used += trace_varint(out, delta);
+ *
+ * @dependencies Aucune.
+ *
+ * @control_flow 1. Écrire 7 bits tant qu'il en reste d'autres.
+ *               2. Écrire le dernier octet.
+ */
+size_t	trace_varint(unsigned char *out, unsigned long value)
+{
+	size_t	len;
+
+	len = 0;
+	while (value > TRACE_VARINT_MASK)
+	{
+		out[len++] = (value & TRACE_VARINT_MASK) | TRACE_VARINT_MORE;
+		value >>= TRACE_VARINT_BITS;
+	}
+	out[len++] = value;
+	return (len);
+}
+
+/**
+ * @function trace_append
+ * @brief Ajoute un enregistrement à la trace, sans formatage.
+ *
+ * @param trace: Pointeur vers la structure t_trace.
+ * @param record: Pointeur vers l'enregistrement.
+ *
+ * @description Deux varints : l'écart d'horodatage avec
+ * l'enregistrement précédent, en microsecondes et en zigzag (les
+ * producteurs ne sont pas strictement ordonnés dans l'anneau), puis
+ * l'identifiant décalé de TRACE_EVENT_BITS avec le code d'évènement.
+ * Fourchettes et repas d'un même instant coûtent deux octets.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects FAILURE si la fenêtre ne peut plus avancer.
+ *
+ * @examples if (trace_append(&log->trace, record))
+ *
+ * @dependencies Dépend de trace_map et trace_varint.
+ *
+ * @control_flow 1. Avancer la fenêtre si elle est pleine.
+ *               2. Encoder l'écart puis l'identifiant et l'évènement.
+ */
+int	trace_append(t_trace *trace, t_log_record *record)
+{
+	long			delta;
+	unsigned char	*out;
+
+	if (!trace->window
+		|| trace->used + TRACE_RECORD_MAX > TRACE_WINDOW)
+		if (trace_map(trace))
+			return (FAILURE);
+	delta = record->time - trace->last;
+	trace->last = record->time;
+	out = trace->window + trace->used;
+	out += trace_varint(out, ((unsigned long)delta << 1)
+			^ (unsigned long)(delta >> (sizeof(long) * CHAR_BIT - 1)));
+	out += trace_varint(out, ((unsigned long)record->id << TRACE_EVENT_BITS)
+			| record->event);
+	trace->used = out - trace->window;
+	return (SUCCESS);
+}
+
+/**
+ * @function trace_close
+ * @brief Ramène le fichier de trace à sa longueur utile et le ferme.
+ *
+ * @param trace: Pointeur vers la structure t_trace.
+ *
+ * @description Sans --trace, ne fait rien. Après un arrêt brutal, le
+ * fichier garde la fin de sa dernière fenêtre à zéro : philo-decode
+ * s'arrête au premier identifiant nul.
+ *
+ * @return int: SUCCESS ou FAILURE.
+ *
+ * @errors/edge_effects FAILURE si ftruncate ou close échoue.
+ *
+ * @examples if (trace_close(&log->trace))
+ *
+ * @dependencies Dépend de munmap, ftruncate et close.
+ *
+ * @control_flow 1. Retirer la fenêtre.
+ *               2. Tronquer puis fermer le fichier.
+ */
+int	trace_close(t_trace *trace)
+{
+	int	error;
+
+	if (trace->fd == TRACE_CLOSED)
+		return (SUCCESS);
+	if (trace->window)
+		munmap(trace->window, TRACE_WINDOW);
+	trace->window = NULL;
+	error = ftruncate(trace->fd, trace->offset + trace->used);
+	if (close(trace->fd))
+		error = FAILURE;
+	trace->fd = TRACE_CLOSED;
+	if (error)
+		return (FAILURE);
+	return (SUCCESS);
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:31:20 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 00:31:20 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        check_word
+ * @brief           Compare la fin d'une ligne à un texte d'évènement.
+ * @param const     char *text - Début du texte, après l'identifiant.
+ * @param size_t    len - Longueur du texte, sans le '\n'.
+ * @param const     char *word - Texte attendu, CHECK_WORD_*.
+ * 
+ * @description     Égalité exacte : "is eating!" n'est pas un repas.
+ * 
+ * @return          Non nul si le texte est exactement word.
+ */
+int	check_word(const char *text, size_t len, const char *word)
+{
+	return (len == strlen(word) && !memcmp(text, word, len));
+}
+
+/**
+ * @function        parse_check_event
+ * @brief           Reconnaît le texte d'un évènement.
+ * @param const     char *text - Début du texte, après l'identifiant.
+ * @param size_t    len - Longueur du texte, sans le '\n'.
+ * 
+ * @description     La première lettre départage les fourchettes et la
+ *                  mort ; pour "is ...", la longueur écarte déjà la
+ *                  plupart des comparaisons.
+ * 
+ * @return          Le code LOG_EV_*, ou CHECK_EV_UNKNOWN.
+ */
+int	parse_check_event(const char *text, size_t len)
+{
+	if (*text == 'h' && check_word(text, len, CHECK_WORD_FORK))
+		return (LOG_EV_FORK);
+	if (*text == 'd' && check_word(text, len, CHECK_WORD_DIED))
+		return (LOG_EV_DIED);
+	if (check_word(text, len, CHECK_WORD_EAT))
+		return (LOG_EV_EAT);
+	if (check_word(text, len, CHECK_WORD_SLEEPING))
+		return (LOG_EV_SLEEPING);
+	if (check_word(text, len, CHECK_WORD_THINKING))
+		return (LOG_EV_THINKING);
+	return (CHECK_EV_UNKNOWN);
+}
+
+/**
+ * @function        parse_check_line
+ * @brief           Découpe une ligne "<ms> <id> <évènement>".
+ * @param const     char *line - Début de la ligne.
+ * @param const     char *end - Son '\n'.
+ * @param t_log_record *record - Reçoit l'horodatage en ms,
+ *                  l'identifiant et le code LOG_EV_*.
+ * 
+ * @description     Un seul passage, sans sscanf ni copie : deux
+ *                  entiers puis le texte, vérifié en entier.
+ * 
+ * @return          SUCCESS, ou FAILURE si la ligne n'a pas ce format.
+ */
+int	parse_check_line(const char *line, const char *end,
+		t_log_record *record)
+{
+	record->time = 0;
+	record->id = 0;
+	if (line == end || *line < '0' || *line > '9')
+		return (FAILURE);
+	while (line < end && *line >= '0' && *line <= '9')
+		record->time = record->time * 10 + *line++ - '0';
+	if (line + 2 > end || *line++ != ' ' || *line < '0' || *line > '9')
+		return (FAILURE);
+	while (line < end && *line >= '0' && *line <= '9')
+		record->id = record->id * 10 + *line++ - '0';
+	if (line == end || *line++ != ' ' || line == end)
+		return (FAILURE);
+	record->event = parse_check_event(line, end - line);
+	if (record->event == CHECK_EV_UNKNOWN)
+		return (FAILURE);
+	return (SUCCESS);
+}
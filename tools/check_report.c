@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:31:20 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 00:31:20 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        check_violation
+ * @brief           Compte une violation et la signale sur stderr.
+ * @param t_check   *check - L'état du contrôle.
+ * @param const     char *what - La règle enfreinte, CHECK_*.
+ * @param t_log_record *record - La ligne fautive.
+ * 
+ * @description     Seules les CHECK_MAX_REPORTS premières sont
+ *                  imprimées : une table cassée en produit autant que
+ *                  de lignes. Toutes sont comptées.
+ * 
+ * @return          Aucun.
+ */
+void	check_violation(t_check *check, const char *what,
+		t_log_record *record)
+{
+	check->violations++;
+	if (check->violations <= CHECK_MAX_REPORTS)
+		fprintf(stderr, CHECK_VIOLATION, check->lines, what, record->time,
+			record->id);
+}
+
+/**
+ * @function        print_check_summary
+ * @brief           Première ligne du bilan : lignes, violations, mort.
+ * @param t_check   *check - L'état du contrôle.
+ * 
+ * @description     Les violations comptent aussi celles qui n'ont pas
+ *                  été imprimées.
+ * 
+ * @return          Aucun.
+ */
+void	print_check_summary(t_check *check)
+{
+	const char	*death;
+
+	death = CHECK_NO_DEATH;
+	if (check->died_at != CHECK_NEVER)
+		death = CHECK_DIED;
+	printf(CHECK_SUMMARY, check->lines, check->violations, death);
+}
+
+/**
+ * @function        print_check_philos
+ * @brief           Une ligne par philosophe : repas et plus long jeûne.
+ * @param t_check   *check - L'état du contrôle.
+ * 
+ * @description     Le jeûne est le plus grand écart entre deux "is
+ *                  eating" successifs, ou entre 0 et le premier.
+ * 
+ * @return          Aucun.
+ */
+void	print_check_philos(t_check *check)
+{
+	int	i;
+
+	i = 0;
+	while (i < check->n_philo)
+	{
+		printf(CHECK_PHILO, i + PHILO_ID_OFFSET, check->philo[i].meals,
+			check->philo[i].max_gap);
+		i++;
+	}
+}
+
+/**
+ * @function        print_check_report
+ * @brief           Imprime le bilan du contrôle sur stdout.
+ * @param t_check   *check - L'état du contrôle.
+ * 
+ * @description     Le bilan général, les extrêmes des repas et du
+ *                  jeûne, puis le détail par philosophe.
+ * 
+ * @return          Aucun.
+ */
+void	print_check_report(t_check *check)
+{
+	int	least;
+	int	most;
+	int	hungriest;
+	int	i;
+
+	least = 0;
+	most = 0;
+	hungriest = 0;
+	i = 0;
+	while (++i < check->n_philo)
+	{
+		if (check->philo[i].meals < check->philo[least].meals)
+			least = i;
+		if (check->philo[i].meals > check->philo[most].meals)
+			most = i;
+		if (check->philo[i].max_gap > check->philo[hungriest].max_gap)
+			hungriest = i;
+	}
+	print_check_summary(check);
+	printf(CHECK_MEALS, check->philo[least].meals, least + PHILO_ID_OFFSET,
+		check->philo[most].meals, most + PHILO_ID_OFFSET,
+		check->philo[hungriest].max_gap, hungriest + PHILO_ID_OFFSET);
+	print_check_philos(check);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   check_rules.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:31:20 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 00:31:20 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        check_eat
+ * @brief           Vérifie un repas et met à jour les compteurs.
+ * @param t_check   *check - L'état du contrôle.
+ * @param t_log_record *record - La ligne "is eating".
+ * 
+ * @description     Le mangeur doit tenir deux fourchettes annoncées
+ *                  depuis son dernier repas. Un voisin qui a commencé à
+ *                  manger moins de t_eat plus tôt mange encore : "is
+ *                  sleeping" ne marque pas la fin du repas, car les
+ *                  fourchettes sont rendues avant d'être journalisées.
+ *                  L'écart entre deux repas part de 0 pour le premier.
+ * 
+ * @return          Aucun.
+ */
+void	check_eat(t_check *check, t_log_record *record)
+{
+	t_check_philo	*philo;
+	t_check_philo	*left;
+	t_check_philo	*right;
+
+	philo = &check->philo[record->id - 1];
+	left = &check->philo[(record->id - 2 + check->n_philo) % check->n_philo];
+	right = &check->philo[record->id % check->n_philo];
+	if (philo->forks < 2)
+		check_violation(check, CHECK_NO_FORKS, record);
+	philo->forks = 0;
+	if ((left != philo && left->last_eat != CHECK_NEVER
+			&& record->time < left->last_eat + check->t_eat)
+		|| (right != philo && right->last_eat != CHECK_NEVER
+			&& record->time < right->last_eat + check->t_eat))
+		check_violation(check, CHECK_NEIGHBOUR, record);
+	if (philo->last_eat == CHECK_NEVER)
+		philo->last_eat = 0;
+	if (record->time - philo->last_eat > philo->max_gap)
+		philo->max_gap = record->time - philo->last_eat;
+	philo->last_eat = record->time;
+	philo->meals++;
+}
+
+/**
+ * @function        check_died
+ * @brief           Vérifie qu'une mort tombe à son échéance.
+ * @param t_check   *check - L'état du contrôle.
+ * @param t_log_record *record - La ligne "died".
+ * 
+ * @description     L'échéance est le dernier repas, ou 0, plus t_die.
+ *                  Horodatages et durées sont tronqués à la
+ *                  milliseconde : une mort juste n'apparaît jamais
+ *                  avant l'échéance, et au plus CHECK_DEATH_SLACK_MS
+ *                  après.
+ * 
+ * @return          Aucun.
+ */
+void	check_died(t_check *check, t_log_record *record)
+{
+	t_check_philo	*philo;
+	long			deadline;
+
+	philo = &check->philo[record->id - 1];
+	deadline = check->t_die;
+	if (philo->last_eat != CHECK_NEVER)
+		deadline += philo->last_eat;
+	check->died_at = record->time;
+	if (record->time < deadline)
+		check_violation(check, CHECK_EARLY_DEATH, record);
+	else if (record->time - deadline > CHECK_DEATH_SLACK_MS)
+		check_violation(check, CHECK_LATE_DEATH, record);
+}
+
+/**
+ * @function        check_record
+ * @brief           Applique les invariants à une ligne lue.
+ * @param t_check   *check - L'état du contrôle.
+ * @param t_log_record *record - La ligne découpée.
+ * 
+ * @description     Rien après "died", un identifiant connu, au plus
+ *                  deux fourchettes tenues, puis les contrôles propres
+ *                  aux repas et aux morts.
+ * 
+ * @return          Aucun.
+ */
+void	check_record(t_check *check, t_log_record *record)
+{
+	if (check->died_at != CHECK_NEVER)
+		check_violation(check, CHECK_AFTER_DEATH, record);
+	if (record->id < 1 || record->id > check->n_philo)
+	{
+		check_violation(check, CHECK_BAD_ID, record);
+		return ;
+	}
+	if (record->event == LOG_EV_FORK
+		&& ++check->philo[record->id - 1].forks > 2)
+		check_violation(check, CHECK_EXTRA_FORK, record);
+	else if (record->event == LOG_EV_EAT)
+		check_eat(check, record);
+	else if (record->event == LOG_EV_DIED)
+		check_died(check, record);
+}
+
+/**
+ * @function        check_meals
+ * @brief           Vérifie en fin d'entrée le nombre de repas.
+ * @param t_check   *check - L'état du contrôle.
+ * 
+ * @description     Avec un nombre de repas et sans mort, chaque
+ *                  philosophe doit les avoir tous pris. La violation
+ *                  porte le nombre de repas pris et l'identifiant.
+ * 
+ * @return          Aucun.
+ */
+void	check_meals(t_check *check)
+{
+	t_log_record	record;
+	int				i;
+
+	if (!check->meals || check->died_at != CHECK_NEVER)
+		return ;
+	i = 0;
+	while (i < check->n_philo)
+	{
+		if (check->philo[i].meals < check->meals)
+		{
+			record.time = check->philo[i].meals;
+			record.id = i + PHILO_ID_OFFSET;
+			check_violation(check, CHECK_HUNGRY, &record);
+		}
+		i++;
+	}
+}
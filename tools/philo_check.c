@@ -0,0 +1,202 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_check.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:31:20 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 00:31:20 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        parse_check_args
+ * @brief           Lit les arguments de philo et l'option --input=.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - Les arguments, ceux passés à philo.
+ * @param t_check   *check - Reçoit n_philo, t_die, t_eat et meals.
+ * @param const     char **input - Reçoit le fichier, NULL pour stdin.
+ * 
+ * @description     Les durées sont ramenées à la milliseconde inférieure,
+ *                  comme les horodatages imprimés. t_sleep n'intervient
+ *                  dans aucun invariant.
+ * 
+ * @return          SUCCESS, ou FAILURE si les arguments sont invalides.
+ */
+int	parse_check_args(int argc, char **argv, t_check *check,
+		const char **input)
+{
+	char	*args[CHECK_MAX_ARGS];
+	int		n;
+	int		i;
+
+	*input = NULL;
+	n = 0;
+	i = 0;
+	while (++i < argc)
+	{
+		if (!strncmp(argv[i], OPT_INPUT, strlen(OPT_INPUT)))
+			*input = argv[i] + strlen(OPT_INPUT);
+		else if (n < CHECK_MAX_ARGS)
+			args[n++] = argv[i];
+	}
+	if (n < CHECK_MIN_ARGS - 1 || n > CHECK_MAX_ARGS - 2)
+		return (FAILURE);
+	check->n_philo = ft_atol(args[0]);
+	check->t_die = ft_atous(args[1]) / US_TO_MS;
+	check->t_eat = ft_atous(args[2]) / US_TO_MS;
+	check->meals = 0;
+	if (n == CHECK_MIN_ARGS)
+		check->meals = ft_atol(args[4]);
+	return (check->n_philo <= 0 || check->t_die <= 0 || check->t_eat <= 0);
+}
+
+/**
+ * @function        init_check
+ * @brief           Prépare l'état du contrôle, philosophes compris.
+ * @param t_check   *check - L'état du contrôle, arguments lus.
+ * 
+ * @description     Aucun philosophe n'a encore mangé ni pris de
+ *                  fourchette, et personne n'est mort.
+ * 
+ * @return          SUCCESS, ou FAILURE si malloc échoue.
+ */
+int	init_check(t_check *check)
+{
+	int	i;
+
+	check->died_at = CHECK_NEVER;
+	check->lines = 0;
+	check->violations = 0;
+	check->philo = malloc(sizeof(t_check_philo) * check->n_philo);
+	if (!check->philo)
+		return (FAILURE);
+	i = 0;
+	while (i < check->n_philo)
+	{
+		check->philo[i].last_eat = CHECK_NEVER;
+		check->philo[i].meals = 0;
+		check->philo[i].max_gap = 0;
+		check->philo[i].forks = 0;
+		i++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        check_buffer
+ * @brief           Contrôle toutes les lignes complètes d'un tampon.
+ * @param t_check   *check - L'état du contrôle.
+ * @param char      *buf - Le tampon.
+ * @param size_t    size - Octets valides dans le tampon.
+ * 
+ * @description     Les lignes sont trouvées par memchr et découpées en
+ *                  place. La ligne incomplète de la fin est ramenée au
+ *                  début du tampon pour la lecture suivante ; une ligne
+ *                  plus longue que le tampon entier est rejetée.
+ * 
+ * @return          Le nombre d'octets gardés en début de tampon.
+ */
+size_t	check_buffer(t_check *check, char *buf, size_t size)
+{
+	t_log_record	record;
+	char			*line;
+	char			*newline;
+
+	line = buf;
+	newline = memchr(line, '\n', size);
+	while (newline)
+	{
+		check->lines++;
+		if (parse_check_line(line, newline, &record))
+			check_violation(check, CHECK_BAD_LINE, &record);
+		else
+			check_record(check, &record);
+		line = newline + 1;
+		newline = memchr(line, '\n', buf + size - line);
+	}
+	if (line == buf && size == CHECK_READ_SIZE)
+	{
+		check->lines++;
+		check_violation(check, CHECK_BAD_LINE, &record);
+		return (0);
+	}
+	memmove(buf, line, buf + size - line);
+	return (buf + size - line);
+}
+
+/**
+ * @function        stream_check
+ * @brief           Lit l'entrée par blocs et la contrôle au fil de l'eau.
+ * @param t_check   *check - L'état du contrôle.
+ * @param int       fd - L'entrée, stdin ou --input=.
+ * 
+ * @description     Lectures de CHECK_READ_SIZE octets, sans stdio :
+ *                  la mémoire ne dépend pas de la taille de l'entrée.
+ *                  Une dernière ligne sans '\n' est contrôlée aussi.
+ * 
+ * @return          SUCCESS, ou FAILURE si malloc ou read échoue.
+ */
+int	stream_check(t_check *check, int fd)
+{
+	char	*buf;
+	size_t	kept;
+	ssize_t	got;
+
+	buf = malloc(CHECK_READ_SIZE + 1);
+	if (!buf)
+		return (FAILURE);
+	kept = 0;
+	got = read(fd, buf, CHECK_READ_SIZE);
+	while (got > 0)
+	{
+		kept = check_buffer(check, buf, kept + got);
+		got = read(fd, buf + kept, CHECK_READ_SIZE - kept);
+	}
+	if (kept && got == 0)
+	{
+		buf[kept++] = '\n';
+		check_buffer(check, buf, kept);
+	}
+	free(buf);
+	return (got < 0);
+}
+
+/**
+ * @function        main
+ * @brief           Contrôle la sortie de philo.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - Les arguments de philo, et --input=.
+ * 
+ * @description     ./philo 5 800 200 200 7 | ./philo-check 5 800 200 200 7
+ *                  Les violations vont sur stderr, le bilan sur stdout.
+ * 
+ * @return          0 si tous les invariants tiennent, 1 sinon.
+ */
+int	main(int argc, char **argv)
+{
+	t_check		check;
+	const char	*input;
+	int			fd;
+	int			error;
+
+	if (parse_check_args(argc, argv, &check, &input))
+		return (fprintf(stderr, ERR_CHECK_USAGE));
+	fd = STDIN_FILENO;
+	if (input)
+		fd = open(input, O_RDONLY);
+	if (fd < 0)
+		return (fprintf(stderr, ERR_CHECK_OPEN, input));
+	if (init_check(&check))
+		return (FAILURE);
+	error = stream_check(&check, fd);
+	if (input)
+		close(fd);
+	check_meals(&check);
+	print_check_report(&check);
+	free(check.philo);
+	return (error || check.violations);
+}
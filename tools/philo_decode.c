@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_decode.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:58:06 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 23:58:06 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        decode_varint
+ * @brief           Lit un varint LEB128 écrit par trace_varint.
+ * @param const     unsigned char **cursor - Position de lecture, avancée.
+ * @param const     unsigned char *end - Fin de la trace.
+ * @param unsigned  long *value - Reçoit la valeur.
+ * 
+ * @description     7 bits par octet, poids faibles d'abord ; le bit de
+ *                  poids fort annonce une suite.
+ * 
+ * @return          SUCCESS, ou FAILURE si la trace s'arrête au milieu
+ *                  du varint ou s'il dépasse DECODE_VARINT_MAX octets.
+ */
+int	decode_varint(const unsigned char **cursor, const unsigned char *end,
+		unsigned long *value)
+{
+	int				shift;
+	unsigned char	byte;
+
+	*value = 0;
+	shift = 0;
+	while (*cursor < end && shift < DECODE_VARINT_MAX * TRACE_VARINT_BITS)
+	{
+		byte = *(*cursor)++;
+		*value |= (unsigned long)(byte & TRACE_VARINT_MASK) << shift;
+		if (!(byte & TRACE_VARINT_MORE))
+			return (SUCCESS);
+		shift += TRACE_VARINT_BITS;
+	}
+	return (FAILURE);
+}
+
+/**
+ * @function        decode_records
+ * @brief           Rejoue les enregistrements d'une trace sur stdout.
+ * @param t_log     *log - Journal dont seul le tampon de sortie sert.
+ * @param const     unsigned char *cursor - Premier enregistrement.
+ * @param const     unsigned char *end - Fin de la trace.
+ * @param unsigned  long *count - Reçoit le nombre d'enregistrements.
+ * 
+ * @description     Chaque enregistrement est un écart d'horodatage en
+ *                  zigzag puis l'identifiant et l'évènement, comme les
+ *                  écrit trace_append. Ils sont imprimés par
+ *                  print_log_record, celui-là même du programme : la
+ *                  sortie est identique octet pour octet. Un
+ *                  identifiant nul marque la fin d'une trace qui n'a pas
+ *                  été fermée.
+ * 
+ * @return          SUCCESS, ou FAILURE si la trace est tronquée.
+ */
+int	decode_records(t_log *log, const unsigned char *cursor,
+		const unsigned char *end, unsigned long *count)
+{
+	t_log_record	record;
+	unsigned long	delta;
+	unsigned long	key;
+
+	record.time = 0;
+	*count = 0;
+	while (cursor < end)
+	{
+		if (decode_varint(&cursor, end, &delta)
+			|| decode_varint(&cursor, end, &key))
+			return (FAILURE);
+		if (!(key >> TRACE_EVENT_BITS))
+			return (SUCCESS);
+		record.time += (long)(delta >> 1) ^ -(long)(delta & 1);
+		record.id = key >> TRACE_EVENT_BITS;
+		record.event = key & TRACE_EVENT_MASK;
+		print_log_record(log, &record);
+		(*count)++;
+	}
+	return (SUCCESS);
+}
+
+/**
+ * @function        map_trace
+ * @brief           Projette un fichier de trace en lecture.
+ * @param const     char *path - Chemin du fichier.
+ * @param size_t    *size - Reçoit la taille du fichier.
+ * 
+ * @description     La trace est lue en place, sans copie.
+ * 
+ * @return          Le fichier projeté, ou MAP_FAILED.
+ */
+void	*map_trace(const char *path, size_t *size)
+{
+	struct stat	st;
+	void		*base;
+	int			fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (MAP_FAILED);
+	base = MAP_FAILED;
+	if (!fstat(fd, &st) && st.st_size >= TRACE_MAGIC_LEN)
+	{
+		*size = st.st_size;
+		base = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	close(fd);
+	return (base);
+}
+
+/**
+ * @function        main
+ * @brief           Décode une trace de --trace en sortie texte.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - Le chemin de la trace.
+ * 
+ * @description     ./philo ... --trace=run.bin puis
+ *                  ./philo-decode run.bin donne exactement ce que
+ *                  ./philo ... aurait imprimé, écrit par blocs de
+ *                  LOG_OUT_SIZE comme le fait philo.
+ * 
+ * @return          SUCCESS, ou non nul si la trace est illisible ou
+ *                  tronquée ; ce qui précède la troncature est imprimé.
+ */
+int	main(int argc, char **argv)
+{
+	unsigned char	*base;
+	size_t			size;
+	unsigned long	count;
+	t_log			log;
+	int				error;
+
+	if (argc != 2)
+		return (fprintf(stderr, ERR_DECODE_USAGE));
+	base = map_trace(argv[1], &size);
+	if (base == MAP_FAILED)
+		return (fprintf(stderr, ERR_DECODE_OPEN, argv[1]));
+	if (memcmp(base, TRACE_MAGIC, TRACE_MAGIC_LEN))
+		return (fprintf(stderr, ERR_DECODE_MAGIC, argv[1]));
+	log.out = malloc(LOG_OUT_SIZE);
+	log.out_len = 0;
+	if (!log.out)
+		return (FAILURE);
+	error = decode_records(&log, base + TRACE_MAGIC_LEN, base + size, &count);
+	flush_log_output(&log);
+	free(log.out);
+	if (error)
+		fprintf(stderr, ERR_DECODE_TRUNCATED, argv[1], count);
+	munmap(base, size);
+	return (error);
+}
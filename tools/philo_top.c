@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_top.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:04:52 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 10:04:52 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        parse_top_args
+ * @brief           Lit le pid observé et les options de philo-top.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - Le pid de philo, --rows=N et --once.
+ * @param t_top     *top - Reçoit pid, rows et once.
+ * 
+ * @description     --rows=N fixe le nombre de philosophes affichés,
+ *                  TOP_DEFAULT_ROWS par défaut, 0 pour le seul bilan.
+ *                  --once affiche un instantané et sort.
+ * 
+ * @return          SUCCESS, ou FAILURE si les arguments sont invalides.
+ */
+int	parse_top_args(int argc, char **argv, t_top *top)
+{
+	int	i;
+
+	top->pid = 0;
+	top->rows = TOP_DEFAULT_ROWS;
+	top->once = 0;
+	i = 0;
+	while (++i < argc)
+	{
+		if (!strncmp(argv[i], OPT_ROWS, strlen(OPT_ROWS)))
+			top->rows = ft_atol(argv[i] + strlen(OPT_ROWS));
+		else if (!strcmp(argv[i], OPT_ONCE))
+			top->once = 1;
+		else if (!top->pid)
+			top->pid = ft_atol(argv[i]);
+		else
+			return (FAILURE);
+	}
+	return (top->pid <= 0 || top->rows < 0);
+}
+
+/**
+ * @function        open_metrics
+ * @brief           Projette en lecture seule le segment de philo --metrics.
+ * @param t_top     *top - Le pid observé ; reçoit la taille du segment.
+ * 
+ * @description     Le segment est retrouvé par son nom, METRICS_NAME et
+ *                  le pid. La projection survit à la fin de philo, qui
+ *                  délie le nom : le dernier instantané reste lisible.
+ * 
+ * @return          Le segment, ou NULL s'il n'existe pas ou n'est pas
+ *                  encore dimensionné.
+ */
+const t_metrics	*open_metrics(t_top *top)
+{
+	char		name[SHM_NAME_LEN];
+	struct stat	st;
+	void		*base;
+	int			fd;
+
+	snprintf(name, SHM_NAME_LEN, METRICS_NAME, top->pid);
+	fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+		return (NULL);
+	base = MAP_FAILED;
+	if (!fstat(fd, &st) && (size_t)st.st_size >= sizeof(t_metrics))
+	{
+		top->size = st.st_size;
+		base = mmap(NULL, top->size, PROT_READ, MAP_SHARED, fd, 0);
+	}
+	close(fd);
+	if (base == MAP_FAILED)
+		return (NULL);
+	return (base);
+}
+
+/**
+ * @function        read_snapshot
+ * @brief           Copie un instantané cohérent, côté lecteur du seqlock.
+ * @param const     t_metrics *shm - Le segment projeté.
+ * @param t_metrics *copy - Reçoit la copie.
+ * @param size_t    size - Taille du segment.
+ * 
+ * @description     Attend que seq soit pair, copie, puis relit seq : une
+ *                  valeur inchangée garantit qu'aucune écriture n'a
+ *                  chevauché la copie, sinon on recommence. Le lecteur
+ *                  n'écrit rien dans le segment et ne peut donc retarder
+ *                  ni l'éditeur ni les philosophes.
+ * 
+ * @return          Aucun.
+ */
+void	read_snapshot(const t_metrics *shm, t_metrics *copy, size_t size)
+{
+	unsigned long	before;
+	unsigned long	after;
+
+	before = 1;
+	after = 0;
+	while (before != after)
+	{
+		before = atomic_load_explicit(&shm->seq, memory_order_acquire);
+		while (before & 1)
+		{
+			sched_yield();
+			before = atomic_load_explicit(&shm->seq, memory_order_acquire);
+		}
+		memcpy(copy, shm, size);
+		atomic_thread_fence(memory_order_acquire);
+		after = atomic_load_explicit(&shm->seq, memory_order_relaxed);
+	}
+}
+
+/**
+ * @function        watch_table
+ * @brief           Rafraîchit l'affichage jusqu'à l'arrêt de la table.
+ * @param const     t_metrics *shm - Le segment projeté.
+ * @param t_top     *top - Les options de philo-top.
+ * @param t_metrics *snap - Tampon de copie, de la taille du segment.
+ * @param int       *best - Tampon des rangs affichés.
+ * 
+ * @description     La vie du processus est testée avant la copie : un
+ *                  philo qui vient de sortir a déjà publié son dernier
+ *                  instantané, qui est donc affiché avant de conclure.
+ * 
+ * @return          SUCCESS, ou FAILURE si philo a disparu sans arrêt.
+ */
+int	watch_table(const t_metrics *shm, t_top *top, t_metrics *snap, int *best)
+{
+	int	alive;
+
+	alive = 1;
+	while (alive)
+	{
+		if (top->once || kill(top->pid, 0))
+			alive = 0;
+		read_snapshot(shm, snap, top->size);
+		print_top(snap, top, best);
+		if (snap->stop)
+			return (SUCCESS);
+		if (alive)
+			usleep(TOP_INTERVAL_US);
+	}
+	return (!top->once);
+}
+
+/**
+ * @function        main
+ * @brief           Affiche l'état d'une table philo --metrics en cours.
+ * @param int       argc - Nombre d'arguments.
+ * @param char      **argv - Le pid de philo, --rows=N et --once.
+ * 
+ * @description     ./philo 200 800 200 200 --metrics & ./philo-top $!
+ *                  Rafraîchit toutes les TOP_INTERVAL_US jusqu'à l'arrêt
+ *                  de la table, ou jusqu'à la disparition du processus.
+ * 
+ * @return          0, ou non nul si le segment est introuvable ou si
+ *                  philo a disparu sans arrêter sa table.
+ */
+int	main(int argc, char **argv)
+{
+	t_top			top;
+	const t_metrics	*shm;
+	t_metrics		*snap;
+	int				*best;
+	int				error;
+
+	if (parse_top_args(argc, argv, &top))
+		return (fprintf(stderr, ERR_TOP_USAGE));
+	shm = open_metrics(&top);
+	if (!shm)
+		return (fprintf(stderr, ERR_TOP_OPEN, top.pid));
+	snap = malloc(top.size);
+	best = malloc(sizeof(int) * (top.rows + 1));
+	if (!snap || !best)
+		return (FAILURE);
+	error = watch_table(shm, &top, snap, best);
+	if (error)
+		fprintf(stderr, ERR_TOP_GONE, top.pid);
+	free(snap);
+	free(best);
+	return (error);
+}
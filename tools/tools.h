@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tools.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:58:06 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/18 23:58:06 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TOOLS_H
+# define TOOLS_H
+# include "../inc/philo.h"
+# include <sys/stat.h>
+/*  DECODE  */
+# define DECODE_VARINT_MAX 10
+# define ERR_DECODE_USAGE "usage: philo-decode TRACE\n"
+# define ERR_DECODE_OPEN "philo-decode: %s: cannot read trace\n"
+# define ERR_DECODE_MAGIC "philo-decode: %s: not a philo trace\n"
+# define ERR_DECODE_TRUNCATED "philo-decode: %s: truncated after %lu records\n"
+/*  CHECK  */
+# define CHECK_READ_SIZE 1048576
+# define CHECK_MAX_REPORTS 20
+# define CHECK_DEATH_SLACK_MS 10
+# define CHECK_NEVER -1
+# define CHECK_EV_UNKNOWN -1
+# define CHECK_MIN_ARGS 5
+# define CHECK_MAX_ARGS 7
+# define OPT_INPUT "--input="
+# define CHECK_WORD_FORK "has taken a fork"
+# define CHECK_WORD_EAT "is eating"
+# define CHECK_WORD_SLEEPING "is sleeping"
+# define CHECK_WORD_THINKING "is thinking"
+# define CHECK_WORD_DIED "died"
+# define CHECK_BAD_LINE "unparsable line"
+# define CHECK_BAD_ID "unknown philosopher"
+# define CHECK_AFTER_DEATH "line after died"
+# define CHECK_EXTRA_FORK "third fork taken"
+# define CHECK_NO_FORKS "eating without two forks"
+# define CHECK_NEIGHBOUR "eating while a neighbour eats"
+# define CHECK_EARLY_DEATH "died before its deadline"
+# define CHECK_LATE_DEATH "died more than 10 ms after its deadline"
+# define CHECK_HUNGRY "fewer meals than required"
+# define CHECK_VIOLATION "philo-check: line %lu: %s: %ld %d\n"
+# define CHECK_SUMMARY "check: %lu lines, %lu violations, %s\n"
+# define CHECK_MEALS "check: meals min %ld (philo %d) max %ld (philo %d), \
+max gap %ld ms (philo %d)\n"
+# define CHECK_PHILO "%d meals=%ld max_gap=%ld\n"
+# define CHECK_DIED "death"
+# define CHECK_NO_DEATH "no death"
+# define ERR_CHECK_USAGE "usage: philo-check n_philo t_die t_eat t_sleep \
+[meals] [--input=FILE] < output\n"
+# define ERR_CHECK_OPEN "philo-check: %s: cannot open\n"
+/*  TOP  */
+# define TOP_INTERVAL_US 500000
+# define TOP_DEFAULT_ROWS 10
+# define OPT_ROWS "--rows="
+# define OPT_ONCE "--once"
+# define TOP_CLEAR "\033[H\033[2J"
+# define TOP_TABLE "philo-top: pid %d, %d seats, %ld ms, %ld meals \
+(%ld meals/s)\n"
+# define TOP_SLACK "slack: min so far %ld us, fork wait avg %ld us\n"
+# define TOP_NO_MEAL "slack: no meal yet\n"
+# define TOP_WATCHING "monitor: %d shard(s) watching %d, next deadline in \
+%ld us\n"
+# define TOP_STOPPED "monitor: stopped (%s)\n"
+# define TOP_HEADER "%6s %8s %12s %10s %14s\n"
+# define TOP_ROW "%6d %8ld %12ld %10ld %14ld\n"
+# define ERR_TOP_USAGE "usage: philo-top PID [--rows=N] [--once]\n"
+# define ERR_TOP_OPEN "philo-top: no metrics for pid %d \
+(run philo with --metrics)\n"
+# define ERR_TOP_GONE "philo-top: pid %d exited without stopping\n"
+
+/*  TYPEDEF STRUCT  */
+typedef struct s_check_philo
+{
+	long			last_eat;
+	long			meals;
+	long			max_gap;
+	int				forks;
+}				t_check_philo;
+typedef struct s_check
+{
+	t_check_philo	*philo;
+	int				n_philo;
+	long			t_die;
+	long			t_eat;
+	long			meals;
+	long			died_at;
+	unsigned long	lines;
+	unsigned long	violations;
+}				t_check;
+typedef struct s_top
+{
+	int				pid;
+	int				rows;
+	int				once;
+	size_t			size;
+}				t_top;
+
+int		parse_check_args(int argc, char **argv, t_check *check,
+			const char **input);
+int		init_check(t_check *check);
+size_t	check_buffer(t_check *check, char *buf, size_t size);
+int		stream_check(t_check *check, int fd);
+int		check_word(const char *text, size_t len, const char *word);
+int		parse_check_event(const char *text, size_t len);
+int		parse_check_line(const char *line, const char *end,
+			t_log_record *record);
+void	check_violation(t_check *check, const char *what,
+			t_log_record *record);
+void	check_eat(t_check *check, t_log_record *record);
+void	check_died(t_check *check, t_log_record *record);
+void	check_record(t_check *check, t_log_record *record);
+void	check_meals(t_check *check);
+void	print_check_summary(t_check *check);
+void	print_check_philos(t_check *check);
+void	print_check_report(t_check *check);
+int		parse_top_args(int argc, char **argv, t_top *top);
+const t_metrics	*open_metrics(t_top *top);
+void	read_snapshot(const t_metrics *shm, t_metrics *copy, size_t size);
+int		select_hungriest(const t_metrics *snap, int *best, int rows);
+void	print_top_summary(const t_metrics *snap, int pid);
+void	print_top(const t_metrics *snap, t_top *top, int *best);
+int		watch_table(const t_metrics *shm, t_top *top, t_metrics *snap,
+			int *best);
+
+#endif
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_report.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: raveriss <raveriss@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:27:18 by raveriss          #+#    #+#             */
+/*   Updated: 2026/10/19 10:27:18 by raveriss         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "tools.h"
+
+/**
+ * @function        select_hungriest
+ * @brief           Retient les philosophes à la plus petite marge.
+ * @param const     t_metrics *snap - L'instantané copié.
+ * @param int       *best - Reçoit les index, par marge croissante.
+ * @param int       rows - Nombre de philosophes voulus.
+ * 
+ * @description     Tri par insertion dans un tableau de rows cases :
+ *                  un seul passage sur la table, sans trier celle-ci.
+ * 
+ * @return          Le nombre d'index retenus, au plus rows.
+ */
+int	select_hungriest(const t_metrics *snap, int *best, int rows)
+{
+	int	count;
+	int	i;
+	int	j;
+
+	count = 0;
+	i = 0;
+	while (i < snap->n_philo)
+	{
+		j = count;
+		if (count < rows)
+			count++;
+		while (j > 0 && snap->philo[i].slack < snap->philo[best[j - 1]].slack)
+		{
+			if (j < rows)
+				best[j] = best[j - 1];
+			j--;
+		}
+		if (j < rows)
+			best[j] = i;
+		i++;
+	}
+	return (count);
+}
+
+/**
+ * @function        print_top_summary
+ * @brief           Affiche le bilan de la table et l'état des moniteurs.
+ * @param const     t_metrics *snap - L'instantané copié.
+ * @param int       pid - Le pid observé.
+ * 
+ * @description     Débit, marge minimale jamais vue, attente moyenne des
+ *                  fourchettes par repas, puis moniteurs en veille ou
+ *                  cause de l'arrêt.
+ * 
+ * @return          Aucun.
+ */
+void	print_top_summary(const t_metrics *snap, int pid)
+{
+	long	meals;
+
+	printf(TOP_TABLE, pid, snap->n_philo, snap->now / US_TO_MS,
+		snap->meals, snap->meals_per_sec);
+	meals = snap->meals;
+	if (!meals)
+		meals = 1;
+	if (snap->min_slack == LONG_MAX)
+		printf(TOP_NO_MEAL);
+	else
+		printf(TOP_SLACK, snap->min_slack, snap->fork_wait / meals);
+	if (snap->stop == SOMEONE_DIED)
+		printf(TOP_STOPPED, STATS_STOP_DIED);
+	else if (snap->stop == ALL_FED)
+		printf(TOP_STOPPED, STATS_STOP_FED);
+	else
+		printf(TOP_WATCHING, snap->n_monitors, snap->watched,
+			snap->next_deadline - snap->now);
+}
+
+/**
+ * @function        print_top
+ * @brief           Affiche un instantané : bilan puis philosophes.
+ * @param const     t_metrics *snap - L'instantané copié.
+ * @param t_top     *top - Les options de philo-top.
+ * @param int       *best - Tampon de top->rows index.
+ * 
+ * @description     Sur un terminal, l'écran est effacé à chaque
+ *                  rafraîchissement. Les philosophes affichés sont les
+ *                  plus proches de la mort : marge la plus petite d'abord.
+ * 
+ * @return          Aucun.
+ */
+void	print_top(const t_metrics *snap, t_top *top, int *best)
+{
+	int	count;
+	int	i;
+
+	if (isatty(STDOUT_FILENO))
+		printf(TOP_CLEAR);
+	print_top_summary(snap, top->pid);
+	count = select_hungriest(snap, best, top->rows);
+	if (count)
+		printf(TOP_HEADER, "philo", "meals", "last meal us", "slack us",
+			"fork wait us");
+	i = 0;
+	while (i < count)
+	{
+		printf(TOP_ROW, best[i] + PHILO_ID_OFFSET,
+			snap->philo[best[i]].meals, snap->philo[best[i]].last_meal_age,
+			snap->philo[best[i]].slack, snap->philo[best[i]].fork_wait);
+		i++;
+	}
+	fflush(stdout);
+}